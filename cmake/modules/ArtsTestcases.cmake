@@ -1,4 +1,4 @@
-macro (ARTS_TEST_RUN_CTLFILE TESTNAME CTLFILE)
+macro (ARTS_TEST_SET_INCLUDE_PATH)
   set(ARTS_TEST_INCLUDE_PATH "${ARTS_SOURCE_DIR}/controlfiles")
 
   if (ARTS_DATA_DIR)
@@ -16,6 +16,10 @@ macro (ARTS_TEST_RUN_CTLFILE TESTNAME CTLFILE)
   else()
     string(APPEND ARTS_TEST_INCLUDE_PATH ";ARTS_CAT_DATA_DIR=${ARTS_BINARY_DIR}/tests/testdata/arts-cat-data")
   endif()
+endmacro (ARTS_TEST_SET_INCLUDE_PATH)
+
+macro (ARTS_TEST_RUN_CTLFILE TESTNAME CTLFILE)
+  arts_test_set_include_path()
 
   string(REGEX REPLACE "/" "." TESTNAME_LONG ${CTLFILE})
   string(REGEX REPLACE ".arts$" "" TESTNAME_LONG ${TESTNAME_LONG})
@@ -46,6 +50,30 @@ macro (ARTS_TEST_RUN_CTLFILE TESTNAME CTLFILE)
   )
 endmacro (ARTS_TEST_RUN_CTLFILE)
 
+macro (ARTS_TEST_RUN_CTLFILE_MPI TESTNAME CTLFILE NPROCS)
+  arts_test_set_include_path()
+
+  get_filename_component(CFILESUBDIR ${CTLFILE} DIRECTORY)
+  string(REGEX REPLACE "/" "." TESTNAME_LONG ${CTLFILE})
+  string(REGEX REPLACE ".arts$" "" TESTNAME_LONG ${TESTNAME_LONG})
+  set(TESTNAME_LONG mpi.${TESTNAME}.${TESTNAME_LONG})
+  # Output files must not clash with the ones of the ctlfile test
+  set(MPI_TEST_DIR ${CMAKE_CURRENT_BINARY_DIR}/mpi)
+  file(MAKE_DIRECTORY ${MPI_TEST_DIR})
+  add_test(
+    NAME ${TESTNAME_LONG}
+    COMMAND ${MPIEXEC_EXECUTABLE} ${MPIEXEC_NUMPROC_FLAG} ${NPROCS}
+            ${MPIEXEC_PREFLAGS} $<TARGET_FILE:arts> ${MPIEXEC_POSTFLAGS}
+            -r002 -I${CMAKE_CURRENT_SOURCE_DIR}
+            ${CMAKE_CURRENT_SOURCE_DIR}/${CTLFILE}
+    WORKING_DIRECTORY ${MPI_TEST_DIR}
+  )
+  set_tests_properties(
+    ${TESTNAME_LONG} PROPERTIES
+    ENVIRONMENT "ARTS_HEADLESS=1;ARTS_INCLUDE_PATH=${CMAKE_CURRENT_SOURCE_DIR}/${CFILESUBDIR}:${ARTS_TEST_INCLUDE_PATH}"
+  )
+endmacro (ARTS_TEST_RUN_CTLFILE_MPI)
+
 macro (ARTS_TEST_RUN_PYFILE TESTNAME PYFILE)
   set(PYARTS_TEST_INCLUDE_PATH "${ARTS_SOURCE_DIR}/controlfiles")
 
@@ -354,6 +354,9 @@ Agenda get_ppath_agenda(Workspace& ws, const String& option) {
     case FollowSensorLosPath:
       agenda.add("ppathStepByStep");
       break;
+    case FollowSensorLosPathField:
+      agenda.add("ppathFromPpathField");
+      break;
     case PlaneParallel:
       agenda.add("ppathPlaneParallel");
       break;
@@ -379,6 +382,9 @@ Agenda get_ppath_step_agenda(Workspace& ws, const String& option) {
     case RefractedPath:
       agenda.add("ppath_stepRefractionBasic");
       break;
+    case RefractedPathField:
+      agenda.add("ppath_stepRefractionField");
+      break;
     case FINAL:
       break;
   }
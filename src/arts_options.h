@@ -77,6 +77,7 @@ ENUMCLASS(iy_cloudbox_agendaDefaultOptions,
 ENUMCLASS(ppath_agendaDefaultOptions,
           char,
           FollowSensorLosPath,
+          FollowSensorLosPathField,
           PlaneParallel,
           TransmitterReceiverPath)
 
@@ -84,7 +85,8 @@ ENUMCLASS(ppath_agendaDefaultOptions,
 ENUMCLASS(ppath_step_agendaDefaultOptions,
           char,
           GeometricPath,
-          RefractedPath)
+          RefractedPath,
+          RefractedPathField)
 
 /** Options for setting refr_index_air_agenda */
 ENUMCLASS(refr_index_air_agendaDefaultOptions,
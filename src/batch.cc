@@ -0,0 +1,789 @@
+/*===========================================================================
+  === File description
+  ===========================================================================*/
+
+/**
+  \file   batch.cc
+  \date   2026-10-19
+
+  \brief  Helpers for the batch methods in m_batch.cc.
+ */
+
+/*===========================================================================
+  === External declarations
+  ===========================================================================*/
+
+#include "batch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <ostream>
+
+#include "arts_omp.h"
+#include "file.h"
+#include "workspace_ng.h"
+#include "xml_io.h"
+
+#ifdef ENABLE_MPI
+#include "mpi.h"
+#endif
+
+/*===========================================================================
+  === Batch engine
+  ===========================================================================*/
+
+std::ostream& operator<<(std::ostream& os, const BatchStatistics& stats) {
+  const Index njobs = stats.job_time.nelem();
+  Index ncalc = 0, slowest = -1;
+  Numeric total = 0, fastest = 0;
+  for (Index i = 0; i < njobs; i++) {
+    const Numeric t = stats.job_time[i];
+    if (std::isnan(t)) continue;
+    if (slowest < 0 or t > stats.job_time[slowest]) slowest = i;
+    if (ncalc == 0 or t < fastest) fastest = t;
+    total += t;
+    ncalc++;
+  }
+
+  os << "  Batch of " << njobs << " jobs: " << ncalc - stats.nfailed
+     << " calculated, " << stats.nfailed << " failed, " << stats.nskipped
+     << " skipped.\n";
+  if (ncalc)
+    os << "  Job time [s]: total " << total << ", min " << fastest
+       << ", mean " << total / static_cast<Numeric>(ncalc) << ", max "
+       << stats.job_time[slowest] << " (job " << slowest << ")\n";
+  return os;
+}
+
+namespace {
+//! Set while this process calculates jobs of a batch shared over MPI
+std::atomic<bool> mpi_batch_active{false};
+
+/** Collects the failed jobs of a batch. */
+class BatchFailures {
+ public:
+  BatchFailures(const BatchSettings& settings_,
+                const BatchJobs& jobs_,
+                const Verbosity& verbosity_)
+      : settings(settings_), jobs(jobs_), verbosity(verbosity_) {}
+
+  /** Adds a failed job.
+   *
+   * @param[in] i Job index, counted from settings.ybatch_start.
+   * @param[in] what The error message.
+   * @param[in] abort Abort the batch, also in robust mode.
+   */
+  void add(const Index i, const String& what, const bool abort) {
+    CREATE_OUTS;
+
+    const Index ybatch_index = settings.ybatch_start + i;
+    nfailed++;
+    if (settings.robust and not abort and not do_abort) {
+      ostringstream os;
+      os << "WARNING! Job at ybatch_index " << ybatch_index << " failed.\n"
+         << jobs.failure_note << "\n"
+         << "The runtime error produced was:\n"
+         << what << "\n";
+      out0 << os.str();
+      if (jobs.on_failure) jobs.on_failure(i);
+    } else {
+      // The user wants the batch job to fail if one of the
+      // jobs goes wrong.
+      do_abort = true;
+
+      ostringstream os;
+      os << "  Job at ybatch_index " << ybatch_index
+         << " failed. Aborting...\n";
+      out1 << os.str();
+    }
+    ostringstream os;
+    os << "Run-time error at ybatch_index " << ybatch_index << ": \n" << what;
+    std::lock_guard lock(fail_msg_mutex);
+    fail_msg.push_back(os.str());
+  }
+
+  /** Adds an error that is not caused by a job. */
+  void add_error(const String& what) {
+    do_abort = true;
+    std::lock_guard lock(fail_msg_mutex);
+    fail_msg.push_back(what);
+  }
+
+  /** Reports the failures.
+   *
+   * @return The error to throw, empty if the batch was not aborted.
+   */
+  [[nodiscard]] String report() const {
+    CREATE_OUT0;
+
+    if (fail_msg.empty()) return "";
+
+    ostringstream os;
+    if (!do_abort) os << "\nError messages from failed batch cases:\n";
+    for (auto& msg : fail_msg) os << msg << '\n';
+
+    if (do_abort) return os.str();
+    out0 << os.str();
+    return "";
+  }
+
+  std::atomic<Index> nfailed{0};
+  std::atomic<bool> do_abort{false};
+
+ private:
+  const BatchSettings& settings;
+  const BatchJobs& jobs;
+  const Verbosity& verbosity;
+  ArrayOfString fail_msg{};
+  std::mutex fail_msg_mutex{};
+};
+
+/** Calculates the jobs of a batch with threads of this process. */
+void batch_run_local(Workspace& ws,
+                     const ArrayOfIndex& order,
+                     const BatchSettings& settings,
+                     const BatchJobs& jobs,
+                     BatchStatistics& stats,
+                     BatchFailures& failures,
+                     const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  const Index njobs = order.nelem();
+
+  // Inside a parallel region all threads are already taken
+  const Index max_threads =
+      arts_omp_in_parallel() ? 1 : arts_omp_get_max_threads();
+  const Index nworkers = std::max<Index>(
+      1,
+      std::min(njobs,
+               settings.max_parallel_jobs ? settings.max_parallel_jobs
+                                          : max_threads));
+  const Index nthreads =
+      settings.nthreads_per_job ? settings.nthreads_per_job
+                                : std::max<Index>(1, max_threads / nworkers);
+
+  std::atomic<Index> next_job{0};
+  std::atomic<Index> job_counter{0};
+
+  const auto work = [&](Workspace& wsw, const Index worker) {
+    while (not failures.do_abort) {
+      const Index k = next_job++;
+      if (k >= njobs) break;
+      const Index i = order[k];
+
+      {
+        ostringstream os;
+        os << "  Job " << ++job_counter << " of " << njobs << ", Index "
+           << settings.ybatch_start + i << ", Thread-Id " << worker << "\n";
+        out2 << os.str();
+      }
+
+      const auto start = std::chrono::steady_clock::now();
+      try {
+        jobs.calc(wsw, i);
+      } catch (const BatchAbort& e) {
+        failures.add(i, e.what(), true);
+      } catch (const std::exception& e) {
+        failures.add(i, e.what(), false);
+      }
+      stats.job_time[i] = std::chrono::duration<Numeric>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+    }
+  };
+
+  if (nworkers == 1 and not settings.nthreads_per_job) {
+    work(ws, 0);
+    return;
+  }
+
+  // Each worker gets its own copy of the workspace, made before any job
+  // is started
+  const WorkspaceOmpParallelCopyGuard wsg{ws, nworkers > 1};
+  std::vector<WorkspaceOmpParallelCopyGuard> wss(nworkers, wsg);
+
+  std::vector<std::thread> workers;
+  workers.reserve(nworkers);
+  for (Index w = 0; w < nworkers; w++)
+    workers.emplace_back([&, w] {
+#ifdef _OPENMP
+      omp_set_num_threads(static_cast<int>(nthreads));
+#endif
+      try {
+        work(wss[w], w);
+      } catch (const std::exception& e) {
+        // Only reached for errors outside of the jobs
+        failures.add_error(e.what());
+      }
+    });
+  for (auto& worker : workers) worker.join();
+}
+
+#ifdef ENABLE_MPI
+//! Message tags of MPI batches
+enum BatchMpiTag : int { TAG_RESULT = 1, TAG_MESSAGE, TAG_JOB };
+
+//! Status of a job, sent with its result
+enum BatchMpiStatus : Index { JOB_NONE, JOB_DONE, JOB_FAILED, JOB_ABORTED };
+
+//! Length of the header of a result: job index, status and time
+constexpr std::size_t result_header = 3;
+
+//! Largest number of elements passed to a single MPI call
+constexpr std::int64_t mpi_max_count = std::numeric_limits<int>::max();
+
+//! Finalises MPI, if not already done
+void batch_mpi_finalize() {
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (!finalized) MPI_Finalize();
+}
+
+//! Initialises MPI, if not already done, and finalises it at exit
+void batch_mpi_init() {
+  int initialized;
+  MPI_Initialized(&initialized);
+  if (!initialized) {
+    int provided;
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_SERIALIZED, &provided);
+  }
+
+  [[maybe_unused]] static const int registered =
+      std::atexit(batch_mpi_finalize);
+}
+
+/** Checks if MPI calls can be made by another thread than the main one.
+ *
+ * The root process then calculates jobs itself, while a separate thread
+ * hands out jobs to the other processes.
+ */
+bool batch_mpi_threads_supported() {
+  int provided;
+  MPI_Query_thread(&provided);
+  return provided >= MPI_THREAD_SERIALIZED;
+}
+
+/** Sends data to another process.
+ *
+ * The number of elements is sent first, followed by the data in messages of
+ * at most mpi_max_count elements, as counts of MPI calls are limited to int.
+ */
+template <typename T>
+void batch_mpi_send(const T* data,
+                    const std::int64_t n,
+                    MPI_Datatype type,
+                    const int dest,
+                    const int tag) {
+  MPI_Send(&n, 1, MPI_INT64_T, dest, tag, MPI_COMM_WORLD);
+  for (std::int64_t i = 0; i < n; i += mpi_max_count)
+    MPI_Send(data + i,
+             static_cast<int>(std::min(mpi_max_count, n - i)),
+             type,
+             dest,
+             tag,
+             MPI_COMM_WORLD);
+}
+
+/** Receives data sent by batch_mpi_send. */
+template <typename Container>
+void batch_mpi_recv(Container& buffer,
+                    MPI_Datatype type,
+                    const int source,
+                    const int tag) {
+  std::int64_t n;
+  MPI_Recv(&n, 1, MPI_INT64_T, source, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+  buffer.resize(static_cast<std::size_t>(n));
+  for (std::int64_t i = 0; i < n; i += mpi_max_count)
+    MPI_Recv(buffer.data() + i,
+             static_cast<int>(std::min(mpi_max_count, n - i)),
+             type,
+             source,
+             tag,
+             MPI_COMM_WORLD,
+             MPI_STATUS_IGNORE);
+}
+
+/** Broadcasts data from the root process, in pieces as batch_mpi_send. */
+template <typename Container>
+void batch_mpi_bcast(Container& buffer, MPI_Datatype type) {
+  std::int64_t n = static_cast<std::int64_t>(buffer.size());
+  MPI_Bcast(&n, 1, MPI_INT64_T, 0, MPI_COMM_WORLD);
+  buffer.resize(static_cast<std::size_t>(n));
+  for (std::int64_t i = 0; i < n; i += mpi_max_count)
+    MPI_Bcast(buffer.data() + i,
+              static_cast<int>(std::min(mpi_max_count, n - i)),
+              type,
+              0,
+              MPI_COMM_WORLD);
+}
+
+/** Calculates a job on this process and packs the result.
+ *
+ * @param[in] ws The workspace.
+ * @param[in] i Job index, counted from settings.ybatch_start.
+ * @param[in] jobs The work to do.
+ * @param[in] pack Pack the result into the buffer.
+ * @param[out] buffer Result header, followed by the packed result.
+ * @param[out] what Error message, empty if the job succeeded.
+ */
+void batch_mpi_calc(Workspace& ws,
+                    const Index i,
+                    const BatchJobs& jobs,
+                    const bool pack,
+                    std::vector<Numeric>& buffer,
+                    String& what) {
+  buffer = {static_cast<Numeric>(i), JOB_DONE, 0};
+  what = "";
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    jobs.calc(ws, i);
+    if (pack) jobs.pack(i, buffer);
+  } catch (const BatchAbort& e) {
+    buffer[1] = JOB_ABORTED;
+    what = e.what();
+  } catch (const std::exception& e) {
+    buffer[1] = JOB_FAILED;
+    what = e.what();
+  }
+  if (buffer[1] != static_cast<Numeric>(JOB_DONE)) {
+    // The message is only sent if not empty
+    if (what.empty()) what = "Unknown error";
+    buffer.resize(result_header);
+  }
+  buffer[2] = std::chrono::duration<Numeric>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+}
+
+/** Sets the number of OpenMP threads used by the jobs of this process.
+ *
+ * @return The previous number of threads.
+ */
+int batch_mpi_set_threads([[maybe_unused]] const BatchSettings& settings) {
+#ifdef _OPENMP
+  const int max_threads = omp_get_max_threads();
+  if (settings.nthreads_per_job)
+    omp_set_num_threads(static_cast<int>(settings.nthreads_per_job));
+  return max_threads;
+#else
+  return 1;
+#endif
+}
+
+/** Distributes the jobs of a batch over the MPI processes.
+ *
+ * The root process hands out the jobs one at a time. Each process asks for a
+ * new job when it has sent the result of the previous one. When all jobs are
+ * done, or the batch is aborted, the processes are told to stop with a job
+ * index of -1.
+ *
+ * If MPI allows it, the jobs are handed out by a separate thread, and the
+ * root process calculates jobs as well. Only that thread makes MPI calls
+ * during the batch.
+ */
+void batch_run_mpi_root(Workspace& ws,
+                        const Index nprocs,
+                        const ArrayOfIndex& order,
+                        const BatchSettings& settings,
+                        const BatchJobs& jobs,
+                        BatchStatistics& stats,
+                        BatchFailures& failures,
+                        const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  const Index njobs = order.nelem();
+  std::mutex job_mutex;
+  Index next_job = 0;
+
+  // Index of the next job to calculate, -1 if there is none
+  const auto take_job = [&](const Index rank) -> Index {
+    std::lock_guard lock(job_mutex);
+    if (failures.do_abort or next_job >= njobs) return -1;
+    const Index i = order[next_job++];
+
+    ostringstream os;
+    os << "  Job " << next_job << " of " << njobs << ", Index "
+       << settings.ybatch_start + i << ", Rank " << rank << "\n";
+    out2 << os.str();
+    return i;
+  };
+
+  // Stores a result. Results of the other processes are unpacked, the ones
+  // calculated here are already in place.
+  const auto store = [&](const std::vector<Numeric>& buffer,
+                         const String& what,
+                         const bool packed) {
+    const auto i = static_cast<Index>(buffer[0]);
+    const auto job_status = static_cast<Index>(buffer[1]);
+    if (job_status != JOB_NONE) stats.job_time[i] = buffer[2];
+
+    if (job_status == JOB_DONE) {
+      if (not packed) return;
+      try {
+        std::size_t pos = result_header;
+        jobs.unpack(i, buffer, pos);
+      } catch (const std::exception& e) {
+        failures.add(i, e.what(), false);
+      }
+    } else if (job_status == JOB_FAILED or job_status == JOB_ABORTED) {
+      failures.add(i, what, job_status == JOB_ABORTED);
+    }
+  };
+
+  const bool root_calculates = batch_mpi_threads_supported();
+
+  const auto dispatch = [&]() {
+    std::vector<Numeric> buffer;
+    String what;
+    Index nworking = nprocs - 1;
+    while (nworking) {
+      // Polling, so that the thread does not take a core from the jobs
+      // of the root process
+      int flag = 0;
+      MPI_Status status;
+      while (true) {
+        MPI_Iprobe(
+            MPI_ANY_SOURCE, TAG_RESULT, MPI_COMM_WORLD, &flag, &status);
+        if (flag) break;
+        if (root_calculates)
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      const int source = status.MPI_SOURCE;
+      batch_mpi_recv(buffer, MPI_DOUBLE, source, TAG_RESULT);
+
+      what = "";
+      const auto job_status = static_cast<Index>(buffer[1]);
+      if (job_status == JOB_FAILED or job_status == JOB_ABORTED)
+        batch_mpi_recv(what, MPI_CHAR, source, TAG_MESSAGE);
+      store(buffer, what, true);
+
+      std::int64_t next = take_job(source);
+      if (next < 0) nworking--;
+      MPI_Send(&next, 1, MPI_INT64_T, source, TAG_JOB, MPI_COMM_WORLD);
+    }
+  };
+
+  if (not root_calculates) {
+    dispatch();
+    return;
+  }
+
+  std::thread dispatcher([&] {
+    try {
+      dispatch();
+    } catch (const std::exception& e) {
+      failures.add_error(e.what());
+    }
+  });
+
+  [[maybe_unused]] const int max_threads = batch_mpi_set_threads(settings);
+  std::vector<Numeric> buffer;
+  String what;
+  for (Index i = take_job(0); i >= 0; i = take_job(0)) {
+    batch_mpi_calc(ws, i, jobs, false, buffer, what);
+    store(buffer, what, false);
+  }
+#ifdef _OPENMP
+  omp_set_num_threads(max_threads);
+#endif
+
+  dispatcher.join();
+}
+
+/** Calculates the jobs handed out by the root process. */
+void batch_run_mpi_worker(Workspace& ws,
+                          const BatchSettings& settings,
+                          const BatchJobs& jobs) {
+  [[maybe_unused]] const int max_threads = batch_mpi_set_threads(settings);
+
+  std::vector<Numeric> buffer{-1, JOB_NONE, 0};
+  String what;
+  while (true) {
+    batch_mpi_send(buffer.data(),
+                   static_cast<std::int64_t>(buffer.size()),
+                   MPI_DOUBLE,
+                   0,
+                   TAG_RESULT);
+    if (what.nelem())
+      batch_mpi_send(what.data(),
+                     static_cast<std::int64_t>(what.size()),
+                     MPI_CHAR,
+                     0,
+                     TAG_MESSAGE);
+
+    std::int64_t i;
+    MPI_Recv(&i, 1, MPI_INT64_T, 0, TAG_JOB, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    if (i < 0) break;
+
+    batch_mpi_calc(ws, i, jobs, true, buffer, what);
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(max_threads);
+#endif
+}
+#endif  // ENABLE_MPI
+}  // namespace
+
+Index batch_mpi_size() {
+#ifdef ENABLE_MPI
+  if (mpi_batch_active or arts_omp_in_parallel()) return 1;
+
+  batch_mpi_init();
+  int size;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+#else
+  return 1;
+#endif
+}
+
+Index batch_mpi_rank() {
+#ifdef ENABLE_MPI
+  if (batch_mpi_size() == 1) return 0;
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+#else
+  return 0;
+#endif
+}
+
+void batch_mpi_broadcast([[maybe_unused]] std::vector<Numeric>& buffer) {
+#ifdef ENABLE_MPI
+  if (batch_mpi_size() == 1) return;
+
+  batch_mpi_bcast(buffer, MPI_DOUBLE);
+#endif
+}
+
+BatchStatistics batch_run(Workspace& ws,
+                          const Index ybatch_n,
+                          const BatchSettings& settings,
+                          const BatchJobs& jobs,
+                          const Verbosity& verbosity) {
+  CREATE_OUT1;
+
+  ARTS_USER_ERROR_IF(settings.cost.nelem() and settings.cost.nelem() != ybatch_n,
+                     "The job cost must be empty or have one element per job.\n"
+                     "Number of jobs: ", ybatch_n, "\n"
+                     "Length of cost: ", settings.cost.nelem())
+  ARTS_USER_ERROR_IF(settings.max_parallel_jobs < 0,
+                     "The maximum number of parallel jobs can not be negative.")
+  ARTS_USER_ERROR_IF(settings.nthreads_per_job < 0,
+                     "The number of threads per job can not be negative.")
+
+  const Index nprocs = batch_mpi_size();
+  const bool root = batch_mpi_rank() == 0;
+
+  BatchStatistics stats;
+  stats.job_time.resize(ybatch_n);
+  stats.job_time = std::numeric_limits<Numeric>::quiet_NaN();
+
+  // The jobs to calculate, the most expensive first
+  ArrayOfIndex order;
+  if (root) {
+    order.reserve(ybatch_n);
+    for (Index i = 0; i < ybatch_n; i++) {
+      if (jobs.skip and jobs.skip(i))
+        stats.nskipped++;
+      else
+        order.push_back(i);
+    }
+    if (settings.cost.nelem())
+      std::stable_sort(order.begin(), order.end(), [&](Index a, Index b) {
+        return settings.cost[a] > settings.cost[b];
+      });
+  }
+
+  BatchFailures failures(settings, jobs, verbosity);
+  if (nprocs == 1) {
+    batch_run_local(ws, order, settings, jobs, stats, failures, verbosity);
+  } else {
+#ifdef ENABLE_MPI
+    mpi_batch_active = true;
+    if (root)
+      batch_run_mpi_root(
+          ws, nprocs, order, settings, jobs, stats, failures, verbosity);
+    else
+      batch_run_mpi_worker(ws, settings, jobs);
+    mpi_batch_active = false;
+#endif
+  }
+  stats.nfailed = failures.nfailed;
+
+  String error;
+  if (root) {
+    // Also when the batch is aborted, so that finished work is kept
+    try {
+      if (jobs.finish) jobs.finish();
+    } catch (const std::exception& e) {
+      failures.add_error(e.what());
+    }
+
+    out1 << stats;
+    error = failures.report();
+  }
+
+#ifdef ENABLE_MPI
+  // All processes fail together
+  if (nprocs > 1) batch_mpi_bcast(error, MPI_CHAR);
+#endif
+  if (error.nelem()) throw runtime_error(error);
+
+  return stats;
+}
+
+/*===========================================================================
+  === YBatchSink
+  ===========================================================================*/
+
+YBatchSink::YBatchSink(const String& basename_,
+                       const Index ybatch_start_,
+                       const Index ybatch_n_,
+                       const Index chunk_size_,
+                       const bool resume,
+                       const Index queue_size_,
+                       const Verbosity& verbosity_)
+    : basename(basename_),
+      ybatch_start(ybatch_start_),
+      ybatch_n(ybatch_n_),
+      chunk_size(chunk_size_),
+      queue_size(static_cast<std::size_t>(std::max<Index>(queue_size_, 1))),
+      verbosity(verbosity_) {
+  ARTS_USER_ERROR_IF(chunk_size < 1,
+                     "The chunk size must be positive, but is ", chunk_size)
+
+  const Index nchunks = (ybatch_n + chunk_size - 1) / chunk_size;
+  done.resize(nchunks);
+  if (resume)
+    for (Index ichunk = 0; ichunk < nchunks; ichunk++)
+      done[ichunk] = file_exists(add_basedir(chunk_filename(ichunk, "ybatch")));
+
+  writer = std::thread(&YBatchSink::run, this);
+}
+
+YBatchSink::~YBatchSink() {
+  if (writer.joinable()) {
+    {
+      std::lock_guard lock(queue_mutex);
+      stopping = true;
+    }
+    queue_not_empty.notify_all();
+    writer.join();
+  }
+}
+
+Index YBatchSink::ndone() const {
+  Index n = 0;
+  for (std::size_t ichunk = 0; ichunk < done.size(); ichunk++)
+    if (done[ichunk]) n += chunk_njobs(static_cast<Index>(ichunk));
+  return n;
+}
+
+void YBatchSink::push(const Index ybatch_index,
+                      Vector&& y,
+                      ArrayOfVector&& y_aux,
+                      Matrix&& jacobian) {
+  {
+    std::unique_lock lock(queue_mutex);
+    queue_not_full.wait(lock, [this] { return queue.size() < queue_size; });
+    queue.push_back(
+        {ybatch_index, std::move(y), std::move(y_aux), std::move(jacobian)});
+  }
+  queue_not_empty.notify_one();
+}
+
+void YBatchSink::finish() {
+  if (writer.joinable()) {
+    {
+      std::lock_guard lock(queue_mutex);
+      stopping = true;
+    }
+    queue_not_empty.notify_all();
+    writer.join();
+  }
+
+  ARTS_USER_ERROR_IF(error.nelem(), "Writing of ybatch results failed:\n", error)
+}
+
+Index YBatchSink::chunk_njobs(const Index ichunk) const {
+  return std::min(chunk_size, ybatch_n - ichunk * chunk_size);
+}
+
+String YBatchSink::chunk_filename(const Index ichunk, const String& name) const {
+  return var_string(
+      basename, '.', ybatch_start + ichunk * chunk_size, '.', name, ".xml");
+}
+
+void YBatchSink::write_chunk(const Index ichunk, const Chunk& chunk) const {
+  xml_write_to_file(chunk_filename(ichunk, "ybatch_jacobians"),
+                    chunk.ybatch_jacobians,
+                    FILE_TYPE_BINARY,
+                    0,
+                    verbosity);
+  xml_write_to_file(chunk_filename(ichunk, "ybatch_aux"),
+                    chunk.ybatch_aux,
+                    FILE_TYPE_BINARY,
+                    0,
+                    verbosity);
+
+  // The ybatch file marks the chunk as complete, so it must not show up
+  // under its final name before it is completely written
+  xml_write_to_file_atomic(
+      chunk_filename(ichunk, "ybatch"), chunk.ybatch, verbosity);
+}
+
+void YBatchSink::run() {
+  // Chunks with at least one, but not all, jobs done
+  std::map<Index, Chunk> chunks;
+
+  while (true) {
+    Result result;
+    {
+      std::unique_lock lock(queue_mutex);
+      queue_not_empty.wait(lock,
+                           [this] { return stopping or not queue.empty(); });
+      if (queue.empty()) break;
+      result = std::move(queue.front());
+      queue.pop_front();
+    }
+    queue_not_full.notify_one();
+
+    // After a failure the queue is only drained, so that no job blocks
+    if (error.nelem()) continue;
+
+    try {
+      const Index ichunk = result.ybatch_index / chunk_size;
+      const Index i = result.ybatch_index - ichunk * chunk_size;
+
+      auto [it, inserted] = chunks.try_emplace(ichunk);
+      Chunk& chunk = it->second;
+      if (inserted) {
+        chunk.nleft = chunk_njobs(ichunk);
+        chunk.ybatch.resize(chunk.nleft);
+        chunk.ybatch_aux.resize(chunk.nleft);
+        chunk.ybatch_jacobians.resize(chunk.nleft);
+      }
+
+      chunk.ybatch[i] = std::move(result.y);
+      chunk.ybatch_aux[i] = std::move(result.y_aux);
+      chunk.ybatch_jacobians[i] = std::move(result.jacobian);
+
+      if (--chunk.nleft == 0) {
+        write_chunk(ichunk, chunk);
+        chunks.erase(it);
+      }
+    } catch (const std::exception& e) {
+      error = e.what();
+    }
+  }
+}
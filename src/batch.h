@@ -0,0 +1,396 @@
+/*===========================================================================
+  === File description
+  ===========================================================================*/
+
+/**
+  \file   batch.h
+  \date   2026-10-19
+
+  \brief  Declaration of helpers for the batch methods in m_batch.cc.
+ */
+
+#ifndef batch_h
+#define batch_h
+
+/*===========================================================================
+  === External declarations
+  ===========================================================================*/
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "array.h"
+#include "arts.h"
+#include "file.h"
+#include "matpack_arrays.h"
+#include "matpack_data.h"
+#include "messages.h"
+#include "mystring.h"
+#include "xml_io.h"
+
+class Workspace;
+
+/*===========================================================================
+  === Batch engine
+  ===========================================================================*/
+
+/** Thrown by a batch job to abort the batch, also in robust mode. */
+class BatchAbort : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+/** How the jobs of a batch are distributed. */
+struct BatchSettings {
+  //! Index of the first job, only used for messages
+  Index ybatch_start{0};
+
+  //! Continue with the other jobs if a job fails
+  bool robust{false};
+
+  //! Estimated relative cost of each job, or empty
+  Vector cost{};
+
+  //! Number of jobs calculated at the same time, 0 for one per thread
+  Index max_parallel_jobs{0};
+
+  //! Threads used inside each job, 0 to share all threads between the jobs
+  Index nthreads_per_job{0};
+};
+
+/** Timing and failure statistics of a batch. */
+struct BatchStatistics {
+  //! Number of jobs not calculated as done before
+  Index nskipped{0};
+
+  //! Number of jobs that failed
+  Index nfailed{0};
+
+  //! Wall-clock time of each job [s], NaN for jobs not calculated
+  Vector job_time{};
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const BatchStatistics& stats);
+};
+
+/** The work of a batch method. */
+struct BatchJobs {
+  //! Calculates a job, given the workspace and the job index counted from
+  //! ybatch_start
+  std::function<void(Workspace&, Index)> calc{};
+
+  //! Returns true for jobs not to calculate, may be empty
+  std::function<bool(Index)> skip{};
+
+  //! Called with the index of a failed job, may be empty
+  std::function<void(Index)> on_failure{};
+
+  //! Explains the output of failed jobs in robust mode
+  String failure_note{};
+
+  //! Moves the results of a job to a buffer, for sending them between MPI
+  //! processes
+  std::function<void(Index, std::vector<Numeric>&)> pack{};
+
+  //! Stores the results of a job from a buffer, starting at the given
+  //! position
+  std::function<void(Index, const std::vector<Numeric>&, std::size_t&)>
+      unpack{};
+
+  //! Called when all jobs are done, by the process holding the results, may
+  //! be empty
+  std::function<void()> finish{};
+};
+
+/** Calculates the jobs of a batch method.
+ *
+ * The jobs are started in order of decreasing cost, if a cost is given, and
+ * otherwise in index order. Each of the concurrently running jobs works on its
+ * own copy of the workspace. The jobs are run by plain threads, so OpenMP
+ * loops inside a job run with settings.nthreads_per_job threads, instead of
+ * being serialised as in a parallel OpenMP region.
+ *
+ * If batch_mpi_size() is larger than 1, the jobs are instead distributed over
+ * the MPI processes, which all must call this function. The root process
+ * hands out the jobs one at a time and collects the results with jobs.pack
+ * and jobs.unpack. Each process calculates one job at a time, the root
+ * process as well if MPI supports calls from a second thread. Data of any
+ * size is passed, split into messages with counts that fit an int.
+ *
+ * A failing job aborts the batch, unless settings.robust is set, in which case
+ * a warning is given. A BatchAbort aborts the batch also in robust mode. Jobs
+ * already started are completed before the errors are reported, by throwing
+ * (abort, on all processes) or on out0 (robust).
+ *
+ * @param[in] ws The workspace.
+ * @param[in] ybatch_n Number of jobs.
+ * @param[in] settings How to distribute the jobs.
+ * @param[in] jobs The work to do.
+ * @param[in] verbosity Verbosity.
+ * @return Statistics of the batch, also written to out1. Only complete on the
+ * root process.
+ */
+BatchStatistics batch_run(Workspace& ws,
+                          const Index ybatch_n,
+                          const BatchSettings& settings,
+                          const BatchJobs& jobs,
+                          const Verbosity& verbosity);
+
+/** Writes a binary XML file that only appears under its name when complete.
+ *
+ * The data is written to a temporary file that is renamed at the end. The
+ * existence of the file can then be used to mark finished work.
+ *
+ * @param[in] filename Name of the file, the output directory is prepended.
+ * @param[in] data The data to write.
+ * @param[in] verbosity Verbosity.
+ */
+template <typename T>
+void xml_write_to_file_atomic(const String& filename,
+                              const T& data,
+                              const Verbosity& verbosity) {
+  const std::string efilename = add_basedir(filename);
+  const std::string tmpname = efilename + ".tmp";
+  xml_write_to_file_base(tmpname, data, FILE_TYPE_BINARY, verbosity);
+  std::filesystem::rename(tmpname + ".bin", efilename + ".bin");
+  std::filesystem::rename(tmpname, efilename);
+}
+
+/*===========================================================================
+  === MPI distribution
+  ===========================================================================*/
+
+/** Number of processes sharing the jobs of a batch.
+ *
+ * This is larger than 1 only if ARTS is compiled with MPI support, runs as
+ * several MPI processes, and the batch is neither started from inside a job
+ * of another batch nor from a parallel region.
+ *
+ * @return Number of processes.
+ */
+Index batch_mpi_size();
+
+/** Rank of this process among those sharing the jobs of a batch.
+ *
+ * @return Rank, 0 for the root process and if batch_mpi_size() is 1.
+ */
+Index batch_mpi_rank();
+
+/** Broadcasts a buffer from the root process to all processes of a batch.
+ *
+ * @param[in,out] buffer Input on the root process, output on the others.
+ */
+void batch_mpi_broadcast(std::vector<Numeric>& buffer);
+
+/** Appends matpack data to a buffer.
+ *
+ * The shape is stored first, so that batch_unpack can restore the data.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] x The data.
+ */
+template <Index N>
+void batch_pack(std::vector<Numeric>& buffer,
+                const matpack::matpack_data<Numeric, N>& x) {
+  for (const Index n : x.shape()) buffer.push_back(static_cast<Numeric>(n));
+  buffer.insert(buffer.end(), x.elem_begin(), x.elem_end());
+}
+
+/** Appends an array to a buffer.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] x The array.
+ */
+template <typename T>
+void batch_pack(std::vector<Numeric>& buffer, const Array<T>& x) {
+  buffer.push_back(static_cast<Numeric>(x.nelem()));
+  for (const auto& xi : x) batch_pack(buffer, xi);
+}
+
+/** Reads matpack data appended to a buffer by batch_pack.
+ *
+ * @param[in] buffer The buffer.
+ * @param[in,out] pos Position of the data, moved past it.
+ * @param[out] x The data.
+ */
+template <Index N>
+void batch_unpack(const std::vector<Numeric>& buffer,
+                  std::size_t& pos,
+                  matpack::matpack_data<Numeric, N>& x) {
+  std::array<Index, N> shape;
+  for (auto& n : shape) n = static_cast<Index>(buffer[pos++]);
+  x.resize(shape);
+  const auto first = buffer.begin() + static_cast<std::ptrdiff_t>(pos);
+  std::copy(first, first + x.size(), x.elem_begin());
+  pos += static_cast<std::size_t>(x.size());
+}
+
+/** Reads an array appended to a buffer by batch_pack.
+ *
+ * @param[in] buffer The buffer.
+ * @param[in,out] pos Position of the array, moved past it.
+ * @param[out] x The array.
+ */
+template <typename T>
+void batch_unpack(const std::vector<Numeric>& buffer,
+                  std::size_t& pos,
+                  Array<T>& x) {
+  x.resize(static_cast<Index>(buffer[pos++]));
+  for (auto& xi : x) batch_unpack(buffer, pos, xi);
+}
+
+/** Copies the elements of an array from the root process to all processes.
+ *
+ * Does nothing if batch_mpi_size() is 1. The array must have the same length
+ * on all processes.
+ *
+ * @param[in,out] x Input on the root process, output on the others.
+ */
+template <typename T>
+void batch_mpi_share(Array<T>& x) {
+  if (batch_mpi_size() == 1) return;
+
+  const bool root = batch_mpi_rank() == 0;
+  std::vector<Numeric> buffer;
+  for (auto& xi : x) {
+    buffer.clear();
+    if (root) batch_pack(buffer, xi);
+    batch_mpi_broadcast(buffer);
+    if (not root) {
+      std::size_t pos = 0;
+      batch_unpack(buffer, pos, xi);
+    }
+  }
+}
+
+/*===========================================================================
+  === Result sinks
+  ===========================================================================*/
+
+/** Streams the results of ybatchCalc to disk.
+ *
+ * The jobs are grouped into chunks of consecutive indices. Results are
+ * handed over with push(), which only blocks while the (bounded) queue is
+ * full. A dedicated writer thread collects the results and, as soon as all
+ * jobs of a chunk are done, writes the chunk as three binary XML files:
+ *
+ *   <basename>.<i0>.ybatch_jacobians.xml
+ *   <basename>.<i0>.ybatch_aux.xml
+ *   <basename>.<i0>.ybatch.xml
+ *
+ * where i0 is the ybatch_index of the first job in the chunk. The ybatch file
+ * is written last and is renamed into place only when complete, its
+ * existence thus marks a finished chunk. When resuming, chunks found on disk
+ * when the sink is created are reported by is_done(), so that a rerun with
+ * the same settings only calculates the missing jobs. Otherwise existing
+ * files are overwritten.
+ */
+class YBatchSink {
+ public:
+  /** Constructor.
+   *
+   * @param[in] basename Base of the chunk file names.
+   * @param[in] ybatch_start Index of the first job.
+   * @param[in] ybatch_n Number of jobs.
+   * @param[in] chunk_size Number of jobs per file.
+   * @param[in] resume Skip the chunks already on disk.
+   * @param[in] queue_size Maximum number of results waiting to be written.
+   * @param[in] verbosity Verbosity, must outlive the sink.
+   */
+  YBatchSink(const String& basename,
+             const Index ybatch_start,
+             const Index ybatch_n,
+             const Index chunk_size,
+             const bool resume,
+             const Index queue_size,
+             const Verbosity& verbosity);
+
+  YBatchSink(const YBatchSink&) = delete;
+  YBatchSink& operator=(const YBatchSink&) = delete;
+
+  /** Stops the writer thread. Incomplete chunks are not written. */
+  ~YBatchSink();
+
+  /** Number of jobs already on disk. */
+  [[nodiscard]] Index ndone() const;
+
+  /** Checks if a job is already on disk.
+   *
+   * @param[in] ybatch_index Job index, counted from ybatch_start.
+   * @return True if the job shall not be calculated.
+   */
+  [[nodiscard]] bool is_done(const Index ybatch_index) const {
+    return done[ybatch_index / chunk_size];
+  }
+
+  /** Hands over the result of a job to the writer thread.
+   *
+   * Failed jobs should be pushed with empty data, otherwise their chunk is
+   * never written.
+   *
+   * @param[in] ybatch_index Job index, counted from ybatch_start.
+   * @param[in] y The measurement vector.
+   * @param[in] y_aux The auxiliary data.
+   * @param[in] jacobian The Jacobian.
+   */
+  void push(const Index ybatch_index,
+            Vector&& y,
+            ArrayOfVector&& y_aux,
+            Matrix&& jacobian);
+
+  /** Writes all remaining complete chunks and stops the writer thread.
+   *
+   * Throws if writing any of the chunks failed.
+   */
+  void finish();
+
+ private:
+  struct Result {
+    Index ybatch_index;
+    Vector y;
+    ArrayOfVector y_aux;
+    Matrix jacobian;
+  };
+
+  struct Chunk {
+    ArrayOfVector ybatch;
+    ArrayOfArrayOfVector ybatch_aux;
+    ArrayOfMatrix ybatch_jacobians;
+    Index nleft;
+  };
+
+  [[nodiscard]] Index chunk_njobs(const Index ichunk) const;
+  [[nodiscard]] String chunk_filename(const Index ichunk,
+                                      const String& name) const;
+  void write_chunk(const Index ichunk, const Chunk& chunk) const;
+  void run();
+
+  String basename;
+  Index ybatch_start;
+  Index ybatch_n;
+  Index chunk_size;
+  std::size_t queue_size;
+  const Verbosity& verbosity;
+
+  std::vector<bool> done;
+
+  std::deque<Result> queue;
+  std::mutex queue_mutex;
+  std::condition_variable queue_not_full;
+  std::condition_variable queue_not_empty;
+  bool stopping{false};
+
+  String error;
+  std::thread writer;
+};
+
+#endif  // batch_h
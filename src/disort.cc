@@ -10,6 +10,7 @@
 
 #include "disort.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
@@ -33,6 +34,7 @@
 #include "logic.h"
 #include "math_funcs.h"
 #include "messages.h"
+#include "physics_funcs.h"
 #include "rte.h"
 #include "xml_io.h"
 
@@ -927,6 +929,118 @@ void reduced_1datm(Vector& p,
   }
 }
 
+namespace {
+thread_local DisortLayerCache* active_layer_cache = nullptr;
+}  // namespace
+
+DisortLayerCache::Activate::Activate(DisortLayerCache* cache)
+    : previous(active_layer_cache) {
+  active_layer_cache = cache;
+}
+
+DisortLayerCache::Activate::~Activate() { active_layer_cache = previous; }
+
+DisortLayerCache* DisortLayerCache::active() { return active_layer_cache; }
+
+void DisortLayerCache::round(VectorView x, const Numeric& tolerance) {
+  if (tolerance <= 0) return;
+  const Numeric dlog = std::log1p(tolerance);
+  for (Index i = 0; i < x.nelem(); i++) {
+    if (x[i] != 0) {
+      const Numeric a = std::abs(x[i]);
+      x[i] = std::copysign(std::exp(dlog * std::round(std::log(a) / dlog)), x[i]);
+    }
+  }
+}
+
+Vector DisortLayerCache::key(ConstVectorView setup,
+                             ConstVectorView level_below,
+                             ConstVectorView level_above) {
+  const Index ns = setup.nelem();
+  const Index nl = level_below.nelem();
+  ARTS_ASSERT(level_above.nelem() == nl);
+
+  Vector k(ns + 2 * nl);
+  k[Range(0, ns)] = setup;
+  k[Range(ns, nl)] = level_below;
+  k[Range(ns + nl, nl)] = level_above;
+  return k;
+}
+
+namespace {
+std::size_t disort_cache_hash(const Vector& key) {
+  std::size_t seed = key.size();
+  for (auto x : key)
+    seed ^= std::hash<Numeric>{}(x) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  return seed;
+}
+
+/** Relation of layer ip to the cloudbox in run_cdisort
+ *
+ * @return 0 if the particles do not affect the layer, 2 if the layer is
+ * covered by the bulk phase function of get_pfct, and 1 otherwise.
+ */
+Index disort_layer_cloud_flag(const Index ip, const ArrayOfIndex& cboxlims) {
+  if (ip + 1 < cboxlims[0] || ip > cboxlims[1]) return 0;
+  // Same range as in get_pfct
+  if (ip >= cboxlims[0] && ip < cboxlims[1] - cboxlims[0]) return 2;
+  return 1;
+}
+}  // namespace
+
+bool DisortLayerCache::get(VectorView ext,
+                           VectorView ssalb,
+                           MatrixView pmom,
+                           const Vector& key) const {
+  const std::size_t h = disort_cache_hash(key);
+
+  std::lock_guard lock{mtx};
+  const auto bucket = data.find(h);
+  if (bucket == data.end()) return false;
+
+  for (auto& e : bucket->second) {
+    if (e.key.size() == key.size() and
+        std::equal(e.key.begin(), e.key.end(), key.begin())) {
+      ext = e.ext;
+      ssalb = e.ssalb;
+      pmom = e.pmom;
+      return true;
+    }
+  }
+  return false;
+}
+
+void DisortLayerCache::set(const Vector& key,
+                           ConstVectorView ext,
+                           ConstVectorView ssalb,
+                           ConstMatrixView pmom) {
+  const std::size_t h = disort_cache_hash(key);
+  const Index n = key.size() + ext.size() + ssalb.size() + pmom.size();
+
+  std::lock_guard lock{mtx};
+  if (nnumerics + n > max_numerics) {
+    data.clear();
+    nentries = 0;
+    nnumerics = 0;
+  }
+
+  data[h].push_back(Entry{key, Vector{ext}, Vector{ssalb}, Matrix{pmom}});
+  nentries++;
+  nnumerics += n;
+}
+
+void DisortLayerCache::clear() {
+  std::lock_guard lock{mtx};
+  data.clear();
+  nentries = 0;
+  nnumerics = 0;
+}
+
+Index DisortLayerCache::size() const {
+  std::lock_guard lock{mtx};
+  return nentries;
+}
+
 void run_cdisort(Workspace& ws,
                  Tensor7& cloudbox_field,
                  ArrayOfMatrix& disort_aux,
@@ -957,6 +1071,7 @@ void run_cdisort(Workspace& ws,
                  const Index& quiet,
                  const Index& emission,
                  const Index& intensity_correction,
+                 const Numeric& layer_cache_tolerance,
                  const Verbosity& verbosity) {
   // Create an atmosphere starting at z_surface
   Vector p, z, t;
@@ -992,6 +1107,19 @@ void run_cdisort(Workspace& ws,
   disort_state ds;
   disort_output out;
 
+  // With a positive cache tolerance, the optical properties are calculated
+  // for the rounded atmospheric state, while the emission is given by the
+  // original temperatures
+  const Vector t_emission{t};
+  if (layer_cache_tolerance > 0) {
+    DisortLayerCache::round(p, layer_cache_tolerance);
+    DisortLayerCache::round(t, layer_cache_tolerance);
+    for (Index i = 0; i < vmr.nrows(); i++)
+      DisortLayerCache::round(vmr(i, joker), layer_cache_tolerance);
+    for (Index i = 0; i < pnd.nrows(); i++)
+      DisortLayerCache::round(pnd(i, joker), layer_cache_tolerance);
+  }
+
   if (quiet == 0)
     disort_verbosity = verbosity;
   else
@@ -1006,8 +1134,6 @@ void run_cdisort(Workspace& ws,
   Numeric umu0 = 0.;
   //local azimuth angle of sun
   Numeric phi0 = 0.;
-  //Intensity of incident sun beam
-  Numeric fbeam = 0.;
 
   Index N_lev= p_grid.nelem();
 
@@ -1064,10 +1190,6 @@ void run_cdisort(Workspace& ws,
   ds.nphi = static_cast<int>(nphi);
   Index Nlegendre = nstreams + 1;
 
-  /* Allocate memory */
-  c_disort_state_alloc(&ds);
-  c_disort_out_alloc(&ds, &out);
-
   // Looking direction of solar beam
   ds.bc.umu0 = umu0;
   ds.bc.phi0 = phi0;
@@ -1075,19 +1197,98 @@ void run_cdisort(Workspace& ws,
   // Intensity of bottom-boundary isotropic illumination
   ds.bc.fluor = 0.;
 
-  // fill up azimuth angle and temperature array
-  for (Index i = 0; i < ds.nphi; i++) ds.phi[i] = aa_grid[i];
+  // Layer optical properties already found in the cache. The cache is owned
+  // by yCalc or iyCalc, and otherwise by this call.
+  const bool use_cache = layer_cache_tolerance >= 0;
+  DisortLayerCache own_layer_cache;
+  DisortLayerCache* layer_cache = DisortLayerCache::active();
+  if (not layer_cache) layer_cache = &own_layer_cache;
+  ArrayOfIndex lyr_found(ds.nlyr, 0);
+  ArrayOfVector lyr_keys(use_cache ? ds.nlyr : 0);
+  Matrix lyr_ext, lyr_ssalb;
+  Tensor3 lyr_pmom;
+  if (use_cache) {
+    lyr_ext.resize(ds.nlyr, nf);
+    lyr_ssalb.resize(ds.nlyr, nf);
+    lyr_pmom.resize(ds.nlyr, nf, Nlegendre);
+
+    // Settings affecting the optical properties, the last element is the
+    // cloud flag of the layer
+    Vector setup(nf + 6);
+    setup[Range(0, nf)] = f_grid;
+    setup[nf] = Numeric(Nlegendre);
+    setup[nf + 1] = Numeric(Npfct);
+    setup[nf + 2] = Numeric(only_tro);
+    setup[nf + 3] = Numeric(gas_scattering_do);
+    setup[nf + 4] = layer_cache_tolerance;
+
+    // State at each level, PNDs are left at zero outside the cloudbox
+    const Index nss = vmr.nrows();
+    const Index nse = pnd.nrows();
+    Matrix level_state(ds.nlyr + 1, 3 + nss + nse, 0.);
+    for (Index ip = 0; ip <= ds.nlyr; ip++) {
+      level_state(ip, 0) = p[ip];
+      level_state(ip, 1) = t[ip];
+      level_state(ip, Range(2, nss)) = vmr(joker, ip);
+      if (ip >= cboxlims[0] && ip <= cboxlims[1]) {
+        level_state(ip, 2 + nss) = 1;
+        level_state(ip, Range(3 + nss, nse)) = pnd(joker, ip - cboxlims[0]);
+      }
+    }
 
-  if  (ds.flag.planck==TRUE){
-    for (Index i = 0; i <= ds.nlyr; i++) ds.temper[i] = t[ds.nlyr - i];
+    for (Index il = 0; il < ds.nlyr; il++) {
+      const Index ip = ds.nlyr - 1 - il;
+      setup[nf + 5] = Numeric(disort_layer_cloud_flag(ip, cboxlims));
+      lyr_keys[il] = DisortLayerCache::key(
+          setup, level_state(ip, joker), level_state(ip + 1, joker));
+      lyr_found[il] = layer_cache->get(lyr_ext(il, joker),
+                                       lyr_ssalb(il, joker),
+                                       lyr_pmom(il, joker, joker),
+                                       lyr_keys[il]);
+    }
   }
 
-  // Transform to mu, starting with negative values
-  for (Index i = 0; i < ds.numu; i++) ds.umu[i] = -cos(za_grid[i] * PI / 180);
+  // Particle and gas scattering properties are only needed if some layer
+  // is missing in the cache
+  bool need_par = pnd_non_zero;
+  bool need_gas_sca = gas_scattering_do;
+  ArrayOfIndex gas_levels;
+  for (Index ip = 0; ip <= ds.nlyr; ip++) {
+    if (!use_cache || (ip > 0 && !lyr_found[ds.nlyr - ip]) ||
+        (ip < ds.nlyr && !lyr_found[ds.nlyr - 1 - ip]))
+      gas_levels.push_back(ip);
+  }
+  if (use_cache) {
+    bool any_missing = false, cloud_missing = false;
+    for (Index il = 0; il < ds.nlyr; il++) {
+      if (!lyr_found[il]) {
+        const Index ip = ds.nlyr - 1 - il;
+        any_missing = true;
+        if (disort_layer_cloud_flag(ip, cboxlims)) cloud_missing = true;
+      }
+    }
+    need_par = need_par && cloud_missing;
+    need_gas_sca = need_gas_sca && any_missing;
+  }
 
   //gas absorption
-  Matrix ext_bulk_gas(nf, ds.nlyr + 1);
-  get_gasoptprop(ws, ext_bulk_gas, propmat_clearsky_agenda, t, vmr, p, f_grid);
+  Matrix ext_bulk_gas(nf, ds.nlyr + 1, 0.);
+  if (gas_levels.nelem() == ds.nlyr + 1) {
+    get_gasoptprop(ws, ext_bulk_gas, propmat_clearsky_agenda, t, vmr, p, f_grid);
+  } else if (gas_levels.nelem()) {
+    const Index nl = gas_levels.nelem();
+    Vector p_sub(nl), t_sub(nl);
+    Matrix vmr_sub(vmr.nrows(), nl), ext_sub(nf, nl);
+    for (Index i = 0; i < nl; i++) {
+      p_sub[i] = p[gas_levels[i]];
+      t_sub[i] = t[gas_levels[i]];
+      vmr_sub(joker, i) = vmr(joker, gas_levels[i]);
+    }
+    get_gasoptprop(
+        ws, ext_sub, propmat_clearsky_agenda, t_sub, vmr_sub, p_sub, f_grid);
+    for (Index i = 0; i < nl; i++)
+      ext_bulk_gas(joker, gas_levels[i]) = ext_sub(joker, i);
+  }
 
 
   //get angles and number of angles
@@ -1101,7 +1302,6 @@ void run_cdisort(Workspace& ws,
   Tensor3 pha_bulk_par(1, ds.nlyr + 1, nang);
   Tensor3 pfct_bulk_par(1, ds.nlyr, nang);
   Tensor3 pmom(1, ds.nlyr, Nlegendre);
-  Vector f_grid_i(1);
   Matrix ssalb(1, ds.nlyr);
   Matrix ext_bulk_gas_i(1, ds.nlyr + 1);
   Matrix dtauc(1, ds.nlyr);
@@ -1127,204 +1327,279 @@ void run_cdisort(Workspace& ws,
     nlinspace(pfct_angs, 0, 180, nang);
   }
 
+  String fail_msg;
+  bool failed = false;
+
+  WorkspaceOmpParallelCopyGuard wss{ws};
   // loop over all frequencies
+#pragma omp parallel for if (!arts_omp_in_parallel() && f_grid.nelem() > 1) \
+    firstprivate(wss, ds, ext_bulk_gas_i, ext_bulk_par, abs_bulk_par, pha_bulk_par, pfct_bulk_par, pmom, ssalb, dtauc, sca_coeff_gas_layer, sca_bulk_par_layer, sca_coeff_gas_level, pmom_gas, out)
   for (Index f_index = 0; f_index < f_grid.nelem(); f_index++) {
+    if (failed) continue;
 
-    f_grid_i=f_grid[f_index];
-
-    // Get particle bulk properties
-    if (pnd_non_zero) {
-      if (only_tro && (Npfct < 0 || Npfct > 3)) {
-        ext_bulk_par = 0.0;
-        abs_bulk_par = 0.0;
-        pha_bulk_par = 0.0;
-
-        Index iflat = 0;
-
-        for (Index iss = 0; iss < scat_data.nelem(); iss++) {
-          const Index nse = scat_data[iss].nelem();
-          ext_abs_pfun_from_tro(ext_bulk_par,
-                                abs_bulk_par,
-                                pha_bulk_par,
-                                scat_data[iss],
-                                iss,
-                                pnd(Range(iflat, nse), joker),
-                                cboxlims,
-                                t,
-                                pfct_angs,
-                                f_index);
-          iflat += nse;
-        }
-      } else {
-        get_paroptprop(ext_bulk_par,
-                       abs_bulk_par,
-                       scat_data,
-                       pnd,
-                       t,
-                       p,
-                       cboxlims,
-                       f_index);
-        get_parZ(pha_bulk_par, scat_data, pnd, t, pfct_angs, cboxlims, f_index);
-      }
-
-      get_pfct(
-          pfct_bulk_par, pha_bulk_par, ext_bulk_par, abs_bulk_par, cboxlims);
-
-      // Legendre's polynomials of phase function
-      get_pmom(pmom, pfct_bulk_par, pfct_angs, Nlegendre);
-    } else {
-      // no particle scattering
-      ext_bulk_par = 0.0;
-      abs_bulk_par = 0.0;
-      pmom = 0.0;
-    }
-
-    if (gas_scattering_do) {
-      // gas scattering
-
-      // layer averaged particle scattering coefficient
-      get_scat_bulk_layer(sca_bulk_par_layer, ext_bulk_par, abs_bulk_par);
-
-      // call gas_scattering_properties
-      get_gas_scattering_properties(ws,
-                                    sca_coeff_gas_layer,
-                                    sca_coeff_gas_level,
-                                    pmom_gas,
-                                    f_grid_i,
-                                    p,
-                                    t,
-                                    vmr,
-                                    gas_scattering_agenda);
-
-      // call add_norm_phase_functions
-      add_normed_phase_functions(
-          pmom, sca_bulk_par_layer, pmom_gas, sca_coeff_gas_layer);
-
-      // add gas_scat_ext to ext_bulk_par
-      ext_bulk_par += sca_coeff_gas_level;
-    }
+    Vector f_grid_i(1);
 
-    // Optical depth of layers
-    // Single scattering albedo of layers
-    ext_bulk_gas_i(0,joker)=ext_bulk_gas(f_index, joker);
-    get_dtauc_ssalb(dtauc, ssalb, ext_bulk_gas_i, ext_bulk_par, abs_bulk_par, z);
+    //Intensity of incident sun beam
+    Numeric fbeam = 0.;
 
-    //upper boundary conditions:
-    // DISORT offers isotropic incoming radiance or emissivity-scaled planck
-    // emission. Both are applied additively.
-    // We want to have cosmic background radiation, for which ttemp=COSMIC_BG_TEMP
-    // and temis=1 should give identical results to fisot(COSMIC_BG_TEMP). As they
-    // are additive we should use either the one or the other.
-    // Note: previous setup (using fisot) setting temis=0 should be avoided.
-    // Generally, temis!=1 should be avoided since that technically implies a
-    // reflective upper boundary (though it seems that this is not exploited in
-    // DISORT1.2, which we so far use).
+    // A possible shift of the solar angle (see below) only applies to the
+    // current frequency
+    Numeric umu0_f = umu0;
+    ds.bc.umu0 = umu0_f;
 
-    // Cosmic background
-    // we use temis*ttemp as upper boundary specification, hence CBR set to 0.
-    ds.bc.fisot = 0;
+    /* Allocate memory */
+    c_disort_state_alloc(&ds);
+    c_disort_out_alloc(&ds, &out);
 
-    // Top of the atmosphere temperature and emissivity
-    ds.bc.ttemp = COSMIC_BG_TEMP;
-    ds.bc.btemp = surface_skin_t;
-    ds.bc.temis = 1.;
+    try {
+      // fill up azimuth angle and temperature array
+      for (Index i = 0; i < ds.nphi; i++) ds.phi[i] = aa_grid[i];
 
+      if  (ds.flag.planck==TRUE){
+        for (Index i = 0; i <= ds.nlyr; i++)
+          ds.temper[i] = t_emission[ds.nlyr - i];
+      }
 
-    snprintf(ds.header, 128, "ARTS Calc f_index = %" PRId64, f_index);
+      // Transform to mu, starting with negative values
+      for (Index i = 0; i < ds.numu; i++) ds.umu[i] = -cos(za_grid[i] * PI / 180);
+
+      f_grid_i=f_grid[f_index];
+
+      // Get particle bulk properties
+      if (need_par) {
+        if (only_tro && (Npfct < 0 || Npfct > 3)) {
+          ext_bulk_par = 0.0;
+          abs_bulk_par = 0.0;
+          pha_bulk_par = 0.0;
+
+          Index iflat = 0;
+
+          for (Index iss = 0; iss < scat_data.nelem(); iss++) {
+            const Index nse = scat_data[iss].nelem();
+            ext_abs_pfun_from_tro(ext_bulk_par,
+                                  abs_bulk_par,
+                                  pha_bulk_par,
+                                  scat_data[iss],
+                                  iss,
+                                  pnd(Range(iflat, nse), joker),
+                                  cboxlims,
+                                  t,
+                                  pfct_angs,
+                                  f_index);
+            iflat += nse;
+          }
+        } else {
+          get_paroptprop(ext_bulk_par,
+                         abs_bulk_par,
+                         scat_data,
+                         pnd,
+                         t,
+                         p,
+                         cboxlims,
+                         f_index);
+          get_parZ(pha_bulk_par, scat_data, pnd, t, pfct_angs, cboxlims, f_index);
+        }
 
-    std::memcpy(ds.dtauc,
-                dtauc(0, joker).unsafe_data_handle(),
-                sizeof(Numeric) * ds.nlyr);
-    std::memcpy(ds.ssalb,
-                ssalb(0, joker).unsafe_data_handle(),
-                sizeof(Numeric) * ds.nlyr);
+        get_pfct(
+            pfct_bulk_par, pha_bulk_par, ext_bulk_par, abs_bulk_par, cboxlims);
 
-    // Wavenumber in [1/cm]
-    ds.wvnmhi = ds.wvnmlo = (f_grid[f_index]) / (100. * SPEED_OF_LIGHT);
-    ds.wvnmhi += ds.wvnmhi * 1e-7;
-    ds.wvnmlo -= ds.wvnmlo * 1e-7;
+        // Legendre's polynomials of phase function
+        get_pmom(pmom, pfct_bulk_par, pfct_angs, Nlegendre);
+      } else {
+        // no particle scattering
+        ext_bulk_par = 0.0;
+        abs_bulk_par = 0.0;
+        pmom = 0.0;
+      }
 
-    // set
-    ds.bc.albedo = surface_scalar_reflectivity[f_index];
+      if (need_gas_sca) {
+        // gas scattering
+
+        // layer averaged particle scattering coefficient
+        get_scat_bulk_layer(sca_bulk_par_layer, ext_bulk_par, abs_bulk_par);
+
+        // call gas_scattering_properties
+        get_gas_scattering_properties(wss,
+                                      sca_coeff_gas_layer,
+                                      sca_coeff_gas_level,
+                                      pmom_gas,
+                                      f_grid_i,
+                                      p,
+                                      t,
+                                      vmr,
+                                      gas_scattering_agenda);
+
+        // call add_norm_phase_functions
+        add_normed_phase_functions(
+            pmom, sca_bulk_par_layer, pmom_gas, sca_coeff_gas_layer);
+
+        // add gas_scat_ext to ext_bulk_par
+        ext_bulk_par += sca_coeff_gas_level;
+      }
 
-    // Set irradiance of incident solar beam at top boundary
-    if (suns_do) {
-      fbeam = suns[0].spectrum(f_index, 0)*(ds.wvnmhi - ds.wvnmlo)*
-              (100 * SPEED_OF_LIGHT)*scale_factor;
-    }
-    ds.bc.fbeam = fbeam;
+      // Optical depth of layers
+      // Single scattering albedo of layers
+      ext_bulk_gas_i(0,joker)=ext_bulk_gas(f_index, joker);
+      get_dtauc_ssalb(dtauc, ssalb, ext_bulk_gas_i, ext_bulk_par, abs_bulk_par, z);
+
+      // Use the cached layers, and keep the others for storing
+      if (use_cache) {
+        for (Index il = 0; il < ds.nlyr; il++) {
+          const Index ip = ds.nlyr - 1 - il;
+          if (lyr_found[il]) {
+            dtauc(0, il) = lyr_ext(il, f_index) * (z[ip + 1] - z[ip]);
+            ssalb(0, il) = lyr_ssalb(il, f_index);
+            pmom(0, il, joker) = lyr_pmom(il, f_index, joker);
+          } else {
+            lyr_ext(il, f_index) =
+                0.5 * (ext_bulk_gas_i(0, ip) + ext_bulk_par(0, ip) +
+                       ext_bulk_gas_i(0, ip + 1) + ext_bulk_par(0, ip + 1));
+            lyr_ssalb(il, f_index) = ssalb(0, il);
+            lyr_pmom(il, f_index, joker) = pmom(0, il, joker);
+          }
+        }
+      }
 
-    std::memcpy(ds.pmom,
-                pmom(0, joker, joker).unsafe_data_handle(),
-                sizeof(Numeric) * pmom.nrows() * pmom.ncols());
+      //upper boundary conditions:
+      // DISORT offers isotropic incoming radiance or emissivity-scaled planck
+      // emission. Both are applied additively.
+      // We want to have cosmic background radiation, for which ttemp=COSMIC_BG_TEMP
+      // and temis=1 should give identical results to fisot(COSMIC_BG_TEMP). As they
+      // are additive we should use either the one or the other.
+      // Note: previous setup (using fisot) setting temis=0 should be avoided.
+      // Generally, temis!=1 should be avoided since that technically implies a
+      // reflective upper boundary (though it seems that this is not exploited in
+      // DISORT1.2, which we so far use).
+
+      // Cosmic background
+      // we use temis*ttemp as upper boundary specification, hence CBR set to 0.
+      ds.bc.fisot = 0;
+
+      // Top of the atmosphere temperature and emissivity
+      ds.bc.ttemp = COSMIC_BG_TEMP;
+      ds.bc.btemp = surface_skin_t;
+      ds.bc.temis = 1.;
+
+
+      snprintf(ds.header, 128, "ARTS Calc f_index = %" PRId64, f_index);
+
+      std::memcpy(ds.dtauc,
+                  dtauc(0, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * ds.nlyr);
+      std::memcpy(ds.ssalb,
+                  ssalb(0, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * ds.nlyr);
+
+      // Wavenumber in [1/cm]
+      ds.wvnmhi = ds.wvnmlo = (f_grid[f_index]) / (100. * SPEED_OF_LIGHT);
+      ds.wvnmhi += ds.wvnmhi * 1e-7;
+      ds.wvnmlo -= ds.wvnmlo * 1e-7;
+
+      // set
+      ds.bc.albedo = surface_scalar_reflectivity[f_index];
+
+      // Set irradiance of incident solar beam at top boundary
+      if (suns_do) {
+        fbeam = suns[0].spectrum(f_index, 0)*(ds.wvnmhi - ds.wvnmlo)*
+                (100 * SPEED_OF_LIGHT)*scale_factor;
+      }
+      ds.bc.fbeam = fbeam;
+
+      std::memcpy(ds.pmom,
+                  pmom(0, joker, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * pmom.nrows() * pmom.ncols());
+
+      enum class Status { FIRST_TRY, RETRY, SUCCESS };
+      Status tries = Status::FIRST_TRY;
+      const Numeric eps = 2e-4; //two times the value defined in cdisort.c:3653
+      do {
+        try {
+          c_disort(&ds, &out);
+          tries = Status::SUCCESS;
+        } catch (const std::runtime_error& e) {
+          //catch cases if solar zenith angle=quadrature angle
+          if (tries == Status::FIRST_TRY) {
+            // change angle
+            if (umu0_f < 1 - eps) {
+              umu0_f += eps;
+            } else if (umu0_f > 1 - eps) {
+              umu0_f -= eps;
+            }
 
-    enum class Status { FIRST_TRY, RETRY, SUCCESS };
-    Status tries = Status::FIRST_TRY;
-    const Numeric eps = 2e-4; //two times the value defined in cdisort.c:3653
-    do {
-      try {
-        c_disort(&ds, &out);
-        tries = Status::SUCCESS;
-      } catch (const std::runtime_error& e) {
-        //catch cases if solar zenith angle=quadrature angle
-        if (tries == Status::FIRST_TRY) {
-          // change angle
-          if (umu0 < 1 - eps) {
-            umu0 += eps;
-          } else if (umu0 > 1 - eps) {
-            umu0 -= eps;
+            const Numeric shift =
+                abs(Conversion::acosd(umu0_f) - Conversion::acosd(ds.bc.umu0));
+            CREATE_OUT1;
+            out1
+                << "Solar zenith angle coincided with one of the quadrature angles\n"
+                << "We needed to shift the solar sun angle by " << shift
+                << "deg.\n";
+
+            ds.bc.umu0 = umu0_f;
+            tries = Status::RETRY;
+          } else
+            throw e;
+        }
+      } while (tries != Status::SUCCESS);
+
+      for (Index i = 0; i < ds.nphi; i++) {
+        for (Index j = 0; j < ds.numu; j++) {
+          for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
+            cloudbox_field(f_index, k + ncboxremoved, 0, 0, j, i, 0) =
+                out.uu[j + ((ds.nlyr - k - cboxlims[0]) + i * (ds.nlyr + 1)) *
+                               ds.numu] /
+                (ds.wvnmhi - ds.wvnmlo) / (100 * SPEED_OF_LIGHT);
           }
+          // To avoid potential numerical problems at interpolation of the field,
+          // we copy the surface field to underground altitudes
+          for (Index k = ncboxremoved - 1; k >= 0; k--) {
+            cloudbox_field(f_index, k, 0, 0, j, i, 0) =
+                cloudbox_field(f_index, k + 1, 0, 0, j, i, 0);
+          }
+        }
+      }
 
-          const Numeric shift =
-              abs(Conversion::acosd(umu0) - Conversion::acosd(ds.bc.umu0));
-          CREATE_OUT1;
-          out1
-              << "Solar zenith angle coincided with one of the quadrature angles\n"
-              << "We needed to shift the solar sun angle by " << shift
-              << "deg.\n";
+      for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
+        deltatau(f_index, k - 1 + ncboxremoved) =
+            dtauc(0, ds.nlyr - k  + cboxlims[0]);
+      }
 
-          ds.bc.umu0 = umu0;
-          tries = Status::RETRY;
-        } else
-          throw e;
+      for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
+        snglsctalbedo(f_index, k - 1 + ncboxremoved) =
+            ssalb(0, ds.nlyr - k + cboxlims[0]);
       }
-    } while (tries != Status::SUCCESS);
 
-    for (Index i = 0; i < ds.nphi; i++) {
-      for (Index j = 0; j < ds.numu; j++) {
-        for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
-          cloudbox_field(f_index, k + ncboxremoved, 0, 0, j, i, 0) =
-              out.uu[j + ((ds.nlyr - k - cboxlims[0]) + i * (ds.nlyr + 1)) *
-                             ds.numu] /
-              (ds.wvnmhi - ds.wvnmlo) / (100 * SPEED_OF_LIGHT);
-        }
-        // To avoid potential numerical problems at interpolation of the field,
-        // we copy the surface field to underground altitudes
-        for (Index k = ncboxremoved - 1; k >= 0; k--) {
-          cloudbox_field(f_index, k, 0, 0, j, i, 0) =
-              cloudbox_field(f_index, k + 1, 0, 0, j, i, 0);
+      if (suns_do){
+        directbeam(f_index, cboxlims[1] - cboxlims[0] + ncboxremoved) =
+            suns[0].spectrum(f_index, 0)/PI;
+
+        for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
+          directbeam(f_index, k - 1 + ncboxremoved) =
+              directbeam(f_index, k + ncboxremoved) *
+              exp(-dtauc(0, ds.nlyr - k + cboxlims[0])/umu0_f);
         }
       }
+    } catch (const std::exception& e) {
+#pragma omp critical(run_cdisort_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
     }
 
-    for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
-      deltatau(f_index, k - 1 + ncboxremoved) =
-          dtauc(0, ds.nlyr - k  + cboxlims[0]);
-    }
-
-    for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
-      snglsctalbedo(f_index, k - 1 + ncboxremoved) =
-          ssalb(0, ds.nlyr - k + cboxlims[0]);
-    }
+    /* Free allocated memory */
+    c_disort_out_free(&ds, &out);
+    c_disort_state_free(&ds);
+  }
 
-    if (suns_do){
-      directbeam(f_index, cboxlims[1] - cboxlims[0] + ncboxremoved) =
-          suns[0].spectrum(f_index, 0)/PI;
+  ARTS_USER_ERROR_IF(failed, fail_msg);
 
-      for (Index k = cboxlims[1] - cboxlims[0]; k > 0; k--) {
-        directbeam(f_index, k - 1 + ncboxremoved) =
-            directbeam(f_index, k + ncboxremoved) *
-            exp(-dtauc(0, ds.nlyr - k + cboxlims[0])/umu0);
+  if (use_cache) {
+    for (Index il = 0; il < ds.nlyr; il++) {
+      if (!lyr_found[il]) {
+        layer_cache->set(lyr_keys[il],
+                         lyr_ext(il, joker),
+                         lyr_ssalb(il, joker),
+                         lyr_pmom(il, joker, joker));
       }
     }
   }
@@ -1357,10 +1632,6 @@ void run_cdisort(Workspace& ws,
     }
   }
 
-  /* Free allocated memory */
-  c_disort_out_free(&ds, &out);
-  c_disort_state_free(&ds);
-
   #else
   ARTS_USER_ERROR("Did not compile with -DENABLE_ARTS_LGPL=0")
   #endif
@@ -1825,6 +2096,347 @@ void run_cdisort_flux(Workspace& ws,
   #endif
 }
 
+void run_two_stream_flux(Workspace& ws,
+                         Tensor5& spectral_irradiance_field,
+                         ConstVectorView f_grid,
+                         ConstVectorView p_grid,
+                         ConstVectorView z_profile,
+                         const Numeric& z_surface,
+                         ConstVectorView t_profile,
+                         ConstMatrixView vmr_profiles,
+                         ConstMatrixView pnd_profiles,
+                         const ArrayOfArrayOfSingleScatteringData& scat_data,
+                         const ArrayOfSun& suns,
+                         const Agenda& propmat_clearsky_agenda,
+                         const Agenda& gas_scattering_agenda,
+                         const ArrayOfIndex& cloudbox_limits,
+                         const Numeric& surface_skin_t,
+                         ConstVectorView albedo,
+                         ConstVectorView sun_rte_los,
+                         const Index& gas_scattering_do,
+                         const Index& suns_do,
+                         const Numeric& scale_factor,
+                         const Index& Npfct,
+                         const Index& emission) {
+  // Create an atmosphere starting at z_surface
+  Vector p, z, t;
+  Matrix vmr, pnd;
+  ArrayOfIndex cboxlims;
+  Index ncboxremoved;
+  //
+  reduced_1datm(p,
+                z,
+                t,
+                vmr,
+                pnd,
+                cboxlims,
+                ncboxremoved,
+                p_grid,
+                z_profile,
+                z_surface,
+                t_profile,
+                vmr_profiles,
+                pnd_profiles,
+                cloudbox_limits);
+
+  //check if pnd field is zero, if yes we do not need to calculate particle
+  //scattering properties
+  bool pnd_non_zero = false;
+  for (Index i = 0; i < pnd.nrows(); i++) {
+    for (Index j = 0; j < pnd.ncols(); j++) {
+      pnd_non_zero += bool(pnd(i, j));
+    }
+  }
+
+  const Index nf = f_grid.nelem();
+  const Index nlyr = p.nelem() - 1;
+
+  // Only the asymmetry parameter is needed
+  const Index Nlegendre = 2;
+
+  //gas absorption
+  Matrix ext_bulk_gas(nf, nlyr + 1);
+  get_gasoptprop(ws, ext_bulk_gas, propmat_clearsky_agenda, t, vmr, p, f_grid);
+
+  //get angles and number of angles
+  Vector pfct_angs;
+  get_angs(pfct_angs, scat_data, Npfct);
+  const Index nang = pfct_angs.nelem();
+
+  // Layer optical properties, layers ordered from the top (as for DISORT)
+  Matrix dtau(nf, nlyr), ssa(nf, nlyr), asym(nf, nlyr, 0.);
+
+  //Allocate
+  Matrix ext_bulk_par(1, nlyr + 1), abs_bulk_par(1, nlyr + 1);
+  Tensor3 pha_bulk_par(1, nlyr + 1, nang);
+  Tensor3 pmom(1, nlyr, Nlegendre);
+  Matrix ext_bulk_gas_i(1, nlyr + 1);
+
+  bool failed = false;
+  String fail_msg;
+
+  WorkspaceOmpParallelCopyGuard wss{ws};
+#pragma omp parallel for if (!arts_omp_in_parallel() && nf > 1) \
+    firstprivate(wss, ext_bulk_gas_i, ext_bulk_par, abs_bulk_par, pha_bulk_par, pmom)
+  for (Index f_index = 0; f_index < nf; f_index++) {
+    if (failed) continue;
+    try {
+      if (pnd_non_zero) {
+        get_paroptprop(ext_bulk_par,
+                       abs_bulk_par,
+                       scat_data,
+                       pnd,
+                       t,
+                       p,
+                       cboxlims,
+                       f_index);
+        get_parZ(pha_bulk_par, scat_data, pnd, t, pfct_angs, cboxlims, f_index);
+
+        //get phase function
+        Tensor3 pfct_bulk_par(1, nlyr, nang);
+        get_pfct(
+            pfct_bulk_par, pha_bulk_par, ext_bulk_par, abs_bulk_par, cboxlims);
+
+        // Legendre's polynomials of phase function
+        get_pmom(pmom, pfct_bulk_par, pfct_angs, Nlegendre);
+      } else {
+        pmom = 0.;
+        ext_bulk_par = 0.;
+        abs_bulk_par = 0.;
+      }
+
+      if (gas_scattering_do) {
+        Matrix sca_coeff_gas_layer(1, nlyr, 0.);
+        Matrix sca_bulk_par_layer(1, nlyr);
+        Matrix sca_coeff_gas_level(1, nlyr + 1, 0.);
+        Matrix pmom_gas(nlyr, Nlegendre, 0.);
+        get_scat_bulk_layer(sca_bulk_par_layer, ext_bulk_par, abs_bulk_par);
+
+        get_gas_scattering_properties(wss,
+                                      sca_coeff_gas_layer,
+                                      sca_coeff_gas_level,
+                                      pmom_gas,
+                                      Vector(1, f_grid[f_index]),
+                                      p,
+                                      t,
+                                      vmr,
+                                      gas_scattering_agenda);
+
+        add_normed_phase_functions(
+            pmom, sca_bulk_par_layer, pmom_gas, sca_coeff_gas_layer);
+
+        ext_bulk_par += sca_coeff_gas_level;
+      }
+
+      ext_bulk_gas_i(0, joker) = ext_bulk_gas(f_index, joker);
+      get_dtauc_ssalb(dtau(Range(f_index, 1), joker),
+                      ssa(Range(f_index, 1), joker),
+                      ext_bulk_gas_i,
+                      ext_bulk_par,
+                      abs_bulk_par,
+                      z);
+
+      for (Index l = 0; l < nlyr; l++) {
+        if (ssa(f_index, l) > 0 && std::isfinite(pmom(0, l, 1))) {
+          asym(f_index, l) = pmom(0, l, 1);
+        }
+      }
+    } catch (const std::exception& e) {
+#pragma omp critical(run_two_stream_flux_fail)
+      {
+        failed = true;
+        fail_msg = e.what();
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg);
+
+  // Diffusivity factor for thermal only calculations
+  constexpr Numeric diffusivity = 1.66;
+
+  // Cosine of solar zenith angle and direct beam at top of atmosphere
+  const Numeric mu0 = suns_do ? Conversion::cosd(sun_rte_los[0]) : 1.;
+
+  // All arrays below are stored with frequency as the fastest running
+  // dimension to allow the solution to be batched over all frequencies.
+  // Levels and layers are ordered from the top.
+  Matrix ref_diff(nlyr, nf), trans_diff(nlyr, nf);
+  Matrix source_up(nlyr, nf, 0.), source_dn(nlyr, nf, 0.);
+  Matrix flux_dir(nlyr + 1, nf, 0.);
+
+  if (suns_do) {
+    for (Index f_index = 0; f_index < nf; f_index++) {
+      flux_dir(0, f_index) =
+          mu0 * suns[0].spectrum(f_index, 0) * scale_factor;
+    }
+  }
+
+  Matrix planck_lev(nlyr + 1, nf, 0.);
+  if (emission) {
+    for (Index l = 0; l <= nlyr; l++) {
+      for (Index f_index = 0; f_index < nf; f_index++) {
+        planck_lev(l, f_index) = PI * planck(f_grid[f_index], t[nlyr - l]);
+      }
+    }
+  }
+
+  for (Index l = 0; l < nlyr; l++) {
+    for (Index f_index = 0; f_index < nf; f_index++) {
+      // delta-Eddington scaling
+      const Numeric g0 = asym(f_index, l);
+      const Numeric fd = g0 * g0;
+      const Numeric w0 = ssa(f_index, l);
+      const Numeric scaling = 1 - w0 * fd;
+      const Numeric od = dtau(f_index, l) * scaling;
+      const Numeric w = scaling > 0 ? w0 * (1 - fd) / scaling : 0.;
+      const Numeric g = g0 / (1 + g0);
+
+      Numeric gamma1, gamma2;
+      if (suns_do) {
+        const Numeric factor = 0.75 * g;
+        gamma1 = 2 - w * (1.25 + factor);
+        gamma2 = w * (0.75 - factor);
+      } else {
+        const Numeric factor = 0.5 * diffusivity * w;
+        gamma1 = diffusivity - factor * (1 + g);
+        gamma2 = factor * (1 - g);
+      }
+
+      // Diffuse reflectance and transmittance
+      const Numeric k =
+          sqrt(std::max((gamma1 - gamma2) * (gamma1 + gamma2), 1e-12));
+      const Numeric exponential = exp(-k * od);
+      const Numeric exponential2 = exponential * exponential;
+      const Numeric reftrans_factor =
+          1 / (k + gamma1 + (k - gamma1) * exponential2);
+      const Numeric R = gamma2 * (1 - exponential2) * reftrans_factor;
+      const Numeric T = 2 * k * exponential * reftrans_factor;
+      ref_diff(l, f_index) = R;
+      trans_diff(l, f_index) = T;
+
+      // Thermal source, Planck function linear in optical depth
+      if (emission) {
+        const Numeric b_top = planck_lev(l, f_index);
+        const Numeric b_bot = planck_lev(l + 1, f_index);
+        if (od > 1e-3) {
+          const Numeric coeff = (b_bot - b_top) / (od * (gamma1 + gamma2));
+          source_up(l, f_index) =
+              coeff + b_top - R * (b_top - coeff) - T * (coeff + b_bot);
+          source_dn(l, f_index) =
+              b_bot - coeff - R * (coeff + b_bot) - T * (b_top - coeff);
+        } else {
+          source_up(l, f_index) = source_dn(l, f_index) =
+              (1 - R - T) * 0.5 * (b_top + b_bot);
+        }
+      }
+
+      // Diffuse source from the direct beam, particular solution of the
+      // two-stream equations per unit of direct flux at the layer top.
+      // The solution is singular for k*mu0 = 1. Similar to what is done for
+      // DISORT in run_cdisort, mu0 is then changed by a relative amount of
+      // eps for the layer, moving k*mu0 away from 1. The direct beam
+      // transmission of the layer then changes by a relative amount of
+      // eps*od/mu0.
+      if (suns_do) {
+        constexpr Numeric eps = 2e-4;
+        Numeric mu0_l = mu0;
+        if (abs(1 - k * mu0) < eps)
+          mu0_l = k * mu0 < 1 ? mu0 * (1 - eps) : mu0 * (1 + eps);
+
+        const Numeric trans_dir = exp(-od / mu0_l);
+        const Numeric gamma3 = 0.5 - 0.75 * g * mu0_l;
+        const Numeric gamma4 = 1 - gamma3;
+        const Numeric alpha1 = gamma1 * gamma4 + gamma2 * gamma3;
+        const Numeric alpha2 = gamma1 * gamma3 + gamma2 * gamma4;
+        const Numeric denom = 1 - k * k * mu0_l * mu0_l;
+        const Numeric a_up = w * (gamma3 - alpha2 * mu0_l) / denom;
+        const Numeric a_dn = -w * (gamma4 + alpha1 * mu0_l) / denom;
+
+        Numeric ref_dir = a_up - R * a_dn - T * a_up * trans_dir;
+        Numeric trans_dir_diff = a_dn * trans_dir - T * a_dn - R * a_up * trans_dir;
+        ref_dir = std::clamp(ref_dir, 0., 1 - trans_dir);
+        trans_dir_diff = std::clamp(trans_dir_diff, 0., 1 - trans_dir - ref_dir);
+
+        source_up(l, f_index) += ref_dir * flux_dir(l, f_index);
+        source_dn(l, f_index) += trans_dir_diff * flux_dir(l, f_index);
+        flux_dir(l + 1, f_index) = trans_dir * flux_dir(l, f_index);
+      }
+    }
+  }
+
+  // Adding method, upward sweep from the surface. albedo_lev and source_lev
+  // are the reflectance and the upward source of everything below a level.
+  Matrix albedo_lev(nlyr + 1, nf), source_lev(nlyr + 1, nf);
+  Matrix inv_denom(nlyr, nf);
+  for (Index f_index = 0; f_index < nf; f_index++) {
+    albedo_lev(nlyr, f_index) = albedo[f_index];
+    source_lev(nlyr, f_index) =
+        albedo[f_index] * flux_dir(nlyr, f_index) +
+        (emission ? (1 - albedo[f_index]) * PI *
+                        planck(f_grid[f_index], surface_skin_t)
+                  : 0.);
+  }
+  for (Index l = nlyr - 1; l >= 0; l--) {
+    for (Index f_index = 0; f_index < nf; f_index++) {
+      const Numeric T = trans_diff(l, f_index);
+      inv_denom(l, f_index) =
+          1 / (1 - albedo_lev(l + 1, f_index) * ref_diff(l, f_index));
+      albedo_lev(l, f_index) = ref_diff(l, f_index) +
+                               T * T * albedo_lev(l + 1, f_index) *
+                                   inv_denom(l, f_index);
+      source_lev(l, f_index) =
+          source_up(l, f_index) +
+          T *
+              (source_lev(l + 1, f_index) +
+               albedo_lev(l + 1, f_index) * source_dn(l, f_index)) *
+              inv_denom(l, f_index);
+    }
+  }
+
+  // Downward sweep, cosmic background as incoming diffuse radiation at top
+  Matrix flux_up(nlyr + 1, nf), flux_dn(nlyr + 1, nf);
+  for (Index f_index = 0; f_index < nf; f_index++) {
+    flux_dn(0, f_index) =
+        emission ? PI * planck(f_grid[f_index], COSMIC_BG_TEMP) : 0.;
+    flux_up(0, f_index) =
+        source_lev(0, f_index) + albedo_lev(0, f_index) * flux_dn(0, f_index);
+  }
+  for (Index l = 0; l < nlyr; l++) {
+    for (Index f_index = 0; f_index < nf; f_index++) {
+      flux_dn(l + 1, f_index) =
+          (trans_diff(l, f_index) * flux_dn(l, f_index) +
+           ref_diff(l, f_index) * source_lev(l + 1, f_index) +
+           source_dn(l, f_index)) *
+          inv_denom(l, f_index);
+      flux_up(l + 1, f_index) =
+          albedo_lev(l + 1, f_index) * flux_dn(l + 1, f_index) +
+          source_lev(l + 1, f_index);
+    }
+  }
+
+  for (Index f_index = 0; f_index < nf; f_index++) {
+    for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
+      const Index l = nlyr - k - cboxlims[0];
+
+      // downward total flux
+      spectral_irradiance_field(f_index, k + ncboxremoved, 0, 0, 0) =
+          -(flux_dn(l, f_index) + flux_dir(l, f_index));
+
+      // upward flux
+      spectral_irradiance_field(f_index, k + ncboxremoved, 0, 0, 1) =
+          flux_up(l, f_index);
+    }
+
+    // To avoid potential numerical problems at interpolation of the field,
+    // we copy the surface field to underground altitudes
+    for (Index k = ncboxremoved - 1; k >= 0; k--) {
+      spectral_irradiance_field(f_index, k, 0, 0, joker) =
+          spectral_irradiance_field(f_index, k + 1, 0, 0, joker);
+    }
+  }
+}
+
 void surf_albedoCalc(Workspace& ws,
                      //Output
                      VectorView albedo,
@@ -18,6 +18,10 @@
 #include "optproperties.h"
 #include "sun.h"
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 
 /** add_normed_phase_functions
  *
@@ -136,6 +140,104 @@ void get_disortsurf_props(  // Output
     const Numeric& surface_skin_t,
     ConstVectorView surface_scalar_reflectivity);
 
+/** Cache of layer optical properties used by run_cdisort
+ *
+ * The pencil beams of *iyIndependentBeamApproximation* give 1D atmospheres
+ * that differ little between neighbouring beams. For each layer, the mean
+ * extinction coefficient, the single scattering albedo and the Legendre
+ * moments of the phase function are stored for all frequencies. The key is
+ * the state (pressure, temperature, VMRs and PNDs) at the two levels
+ * bounding the layer, together with the frequencies and the settings that
+ * affect the optical properties.
+ *
+ * *yCalc* and *iyCalc* own a cache for the duration of the call, and make
+ * it available to run_cdisort through Activate. Otherwise, the cache is
+ * local to the run_cdisort call.
+ */
+class DisortLayerCache {
+ public:
+  /** Upper limit of the number of Numeric stored before a reset */
+  static constexpr Index max_numerics = 10'000'000;
+
+  /** Makes a cache the active one of the calling thread
+   *
+   * The previously active cache is restored when the object is destroyed.
+   * The setting is local to the thread, and OpenMP loops executing
+   * *iy_main_agenda* must activate the cache in each iteration.
+   */
+  class Activate {
+   public:
+    explicit Activate(DisortLayerCache* cache);
+    Activate(const Activate&) = delete;
+    Activate& operator=(const Activate&) = delete;
+    ~Activate();
+
+   private:
+    DisortLayerCache* previous;
+  };
+
+  /** The cache active in the calling thread, nullptr if there is none */
+  static DisortLayerCache* active();
+
+  /** Rounds atmospheric state values to a relative precision
+   *
+   * With a positive tolerance, layers with almost identical states share
+   * a cache entry. The optical properties are then calculated for the
+   * rounded state, so that an entry does not depend on which layer that
+   * created it. Zero values are kept. Nothing is done for a tolerance of
+   * zero or below.
+   *
+   * @param[in,out] x Values to round
+   * @param[in] tolerance Relative tolerance
+   */
+  static void round(VectorView x, const Numeric& tolerance);
+
+  /** Creates the cache key for a layer
+   *
+   * @param[in] setup Frequencies and settings of the calculation
+   * @param[in] level_below State at lower level of the layer
+   * @param[in] level_above State at upper level of the layer
+   * @return The key
+   */
+  static Vector key(ConstVectorView setup,
+                    ConstVectorView level_below,
+                    ConstVectorView level_above);
+
+  /** Copies a cached entry to the output variables
+   *
+   * @return true if key was found, otherwise the output is untouched
+   */
+  bool get(VectorView ext,
+           VectorView ssalb,
+           MatrixView pmom,
+           const Vector& key) const;
+
+  /** Adds a new entry to the cache */
+  void set(const Vector& key,
+           ConstVectorView ext,
+           ConstVectorView ssalb,
+           ConstMatrixView pmom);
+
+  /** Removes all entries */
+  void clear();
+
+  /** Number of entries */
+  [[nodiscard]] Index size() const;
+
+ private:
+  struct Entry {
+    Vector key;
+    Vector ext;
+    Vector ssalb;
+    Matrix pmom;
+  };
+
+  mutable std::mutex mtx;
+  std::unordered_map<std::size_t, std::vector<Entry>> data;
+  Index nentries{0};
+  Index nnumerics{0};
+};
+
 /** Calculate doit_i_field with Disort including a sun source.
  *
  * Prepares actual input variables for Disort, runs it, and sorts the output
@@ -181,6 +283,9 @@ void get_disortsurf_props(  // Output
  * @param[in]     quiet Silence warnings.
  * @param[in]     emission Enables blackbody emission.
  * @param[in]     intensity_correction Enables intensity correction (for low nstreams)
+ * @param[in]     layer_cache_tolerance Relative tolerance for reusing layer
+ *                optical properties through DisortLayerCache. A negative
+ *                value deactivates the cache.
  * @param[in]     verbosity Verbosity setting.
  *
  * @author        Oliver Lemke, Manfred Brath
@@ -216,6 +321,7 @@ void run_cdisort(Workspace& ws,
                  const Index& quiet,
                  const Index& emission,
                  const Index& intensity_correction,
+                 const Numeric& layer_cache_tolerance,
                  const Verbosity& verbosity);
 
 /** Calculate  spectral_irradiance_field with Disort including a sun source.
@@ -296,6 +402,76 @@ void run_cdisort_flux(Workspace& ws,
                       const Index& intensity_correction,
                       const Verbosity& verbosity);
 
+/** run_two_stream_flux
+ *
+ * Calculates the spectral irradiance field with a delta-Eddington two-stream
+ * solver, as a fast alternative to ::run_cdisort_flux.
+ *
+ * The gas and particle bulk optical properties are derived as for DISORT,
+ * but only the asymmetry parameter of the bulk phase function is kept.
+ * Each layer is described by its diffuse reflectance and transmittance
+ * following Meador and Weaver (1980), and the fluxes are obtained by the
+ * adding method, i.e. the elimination of the tridiagonal system coupling
+ * the levels. The solution is batched over all frequencies.
+ *
+ * With an active sun, the practical improved flux method (PIFM) coefficients
+ * of Zdunkowski et al. (1980) are used, otherwise the diffusivity
+ * approximation with a diffusivity factor of 1.66.
+ *
+ * @param[in,out] ws Current workspace.
+ * @param[out]    spectral_irradiance_field spectral irradiance field.
+ * @param[in]     f_grid Frequency grid.
+ * @param[in]     p_grid Pressure grid.
+ * @param[in]     z_profile Profile of geometric altitudes.
+ * @param[in]     z_surface Surface altitude.
+ * @param[in]     t_profile Temperature profile.
+ * @param[in]     vmr_profiles VMR profiles.
+ * @param[in]     pnd_profiles PND profiles.
+ * @param[in]     scat_data Array of single scattering data.
+ * @param[in]     suns Array of sun(s).
+ * @param[in]     propmat_clearsky_agenda calculates the absorption coefficient
+                  matrix.
+ * @param[in]     gas_scattering_agenda Agenda agenda calculating the gas scattering
+                  cross section and matrix.
+ * @param[in]     cloudbox_limits Cloudbox limits.
+ * @param[in]     surface_skin_t Surface skin temperature.
+ * @param[in]     albedo Surface albedo for each frequency.
+ * @param[in]     sun_rte_los local position of the sun top of cloudbox.
+ * @param[in]     gas_scattering_do Flag to activate gas scattering.
+ * @param[in]     suns_do Flag to activate the sun(s).
+ * @param[in]     scale_factor Geometric scaling factor, scales the sun spectral
+ *                irradiance at the surface of the sun to the spectral irradiance
+ *                of the sun at cloubbox top.
+ * @param[in]     Npfct Number of angular grid points to calculate bulk phase
+ *                function.
+ * @param[in]     emission Enables blackbody emission.
+ *
+ * @author        agent
+ * @date          2026-10-19
+ */
+void run_two_stream_flux(Workspace& ws,
+                         Tensor5& spectral_irradiance_field,
+                         ConstVectorView f_grid,
+                         ConstVectorView p_grid,
+                         ConstVectorView z_profile,
+                         const Numeric& z_surface,
+                         ConstVectorView t_profile,
+                         ConstMatrixView vmr_profiles,
+                         ConstMatrixView pnd_profiles,
+                         const ArrayOfArrayOfSingleScatteringData& scat_data,
+                         const ArrayOfSun& suns,
+                         const Agenda& propmat_clearsky_agenda,
+                         const Agenda& gas_scattering_agenda,
+                         const ArrayOfIndex& cloudbox_limits,
+                         const Numeric& surface_skin_t,
+                         ConstVectorView albedo,
+                         ConstVectorView sun_rte_los,
+                         const Index& gas_scattering_do,
+                         const Index& suns_do,
+                         const Numeric& scale_factor,
+                         const Index& Npfct,
+                         const Index& emission);
+
 /** get_gasoptprop.
  *
  * Derives level-based gas bulk optical properties (extinction).
@@ -13,6 +13,7 @@
   ===========================================================================*/
 
 #include "doit.h"
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -1668,6 +1669,95 @@ void cloudbox_field_ngAcceleration(Tensor6& cloudbox_field_mono,
   }
 }
 
+void cloudbox_field_andersonAcceleration(Tensor6& cloudbox_field_mono,
+                                         ArrayOfTensor6& anderson_f,
+                                         ArrayOfTensor6& anderson_g,
+                                         const Tensor6& cloudbox_field_mono_old,
+                                         const Index& depth,
+                                         const Verbosity& verbosity) {
+  CREATE_OUT3;
+
+  const Index N = cloudbox_field_mono.size();
+
+  // Residual of this iteration
+  Tensor6 f = cloudbox_field_mono;
+  f -= cloudbox_field_mono_old;
+
+  anderson_f.push_back(f);
+  anderson_g.push_back(cloudbox_field_mono);
+  if (anderson_f.nelem() > depth + 1) {
+    anderson_f.erase(anderson_f.begin());
+    anderson_g.erase(anderson_g.begin());
+  }
+
+  const Index m = anderson_f.nelem() - 1;
+  if (m < 1) return;
+
+  // Differences between consecutive residuals, flattened
+  Matrix dF(N, m);
+  for (Index j = 0; j < m; j++) {
+    auto f1 = anderson_f[j + 1].elem_begin();
+    auto f0 = anderson_f[j].elem_begin();
+    for (Index i = 0; i < N; i++, ++f1, ++f0) dF(i, j) = *f1 - *f0;
+  }
+
+  // Normal equations of the least-squares problem
+  Matrix A(m, m, 0);
+  Vector b(m, 0);
+  {
+    auto fk = f.elem_begin();
+    for (Index i = 0; i < N; i++, ++fk) {
+      for (Index j = 0; j < m; j++) {
+        b[j] += dF(i, j) * *fk;
+        for (Index k = 0; k <= j; k++) A(j, k) += dF(i, j) * dF(i, k);
+      }
+    }
+  }
+  Numeric trace = 0;
+  for (Index j = 0; j < m; j++) {
+    for (Index k = 0; k < j; k++) A(k, j) = A(j, k);
+    trace += A(j, j);
+  }
+
+  if (trace == 0 or not std::isfinite(trace)) {
+    out3 << "  Anderson acceleration skipped (singular history).\n";
+    return;
+  }
+
+  // Small Tikhonov term for stability
+  for (Index j = 0; j < m; j++) A(j, j) += 1e-12 * trace;
+
+  Vector gamma(m);
+  solve(gamma, A, b);
+
+  // x_{k+1} = G(x_k) - dG gamma
+  Tensor6 x = cloudbox_field_mono;
+  for (Index j = 0; j < m; j++) {
+    auto xi = x.elem_begin();
+    auto g1 = anderson_g[j + 1].elem_begin();
+    auto g0 = anderson_g[j].elem_begin();
+    for (Index i = 0; i < N; i++, ++xi, ++g1, ++g0)
+      *xi -= gamma[j] * (*g1 - *g0);
+  }
+
+  // The mixed field must be finite and have a non-negative intensity
+  if (std::any_of(x.elem_begin(), x.elem_end(), [](auto v) {
+        return not std::isfinite(v);
+      })) {
+    out3 << "  Anderson acceleration skipped (non-finite mixed field).\n";
+    return;
+  }
+  const auto intensity = x(joker, joker, joker, joker, joker, 0);
+  if (std::any_of(intensity.elem_begin(), intensity.elem_end(), [](auto v) {
+        return v < 0;
+      })) {
+    out3 << "  Anderson acceleration skipped (negative intensity).\n";
+    return;
+  }
+
+  cloudbox_field_mono = x;
+}
+
 void interp_cloud_coeff1D(  //Output
     Tensor3View ext_mat_int,
     MatrixView abs_vec_int,
@@ -515,6 +515,34 @@ void cloudbox_field_ngAcceleration(  //Output
     const Index& accelerated,
     const Verbosity& verbosity);
 
+//! Anderson acceleration of the DOIT iteration
+/*!
+  Applies Anderson mixing to the fixed-point iteration x = G(x), where G
+  is one DOIT sweep (scattering integral followed by RT). The new field is
+  set to G(x_k) - dG gamma, where gamma minimises the norm of
+  f_k - dF gamma. f = G(x) - x is the residual, and dF and dG hold the
+  differences between consecutive residuals and sweep outputs,
+  respectively, of the last ``depth`` iterations.
+
+  If the least-squares problem is singular, or the mixed field contains
+  NaN, G(x_k) is kept, i.e. a plain iteration is made.
+
+  \param[in,out] cloudbox_field_mono In: G(x_k). Out: Mixed field x_{k+1}
+  \param[in,out] anderson_f Residuals of previous iterations (oldest first)
+  \param[in,out] anderson_g Sweep outputs of previous iterations (oldest first)
+  \param[in]     cloudbox_field_mono_old x_k
+  \param[in]     depth Number of previous iterations to consider
+  \param[in]     verbosity Verbosity setting
+*/
+void cloudbox_field_andersonAcceleration(  //Output
+    Tensor6& cloudbox_field_mono,
+    ArrayOfTensor6& anderson_f,
+    ArrayOfTensor6& anderson_g,
+    //Input
+    const Tensor6& cloudbox_field_mono_old,
+    const Index& depth,
+    const Verbosity& verbosity);
+
 //! Interpolate all inputs of the VRTE on a propagation path step
 /*!
   Used in the WSM cloud_ppath_update1D.
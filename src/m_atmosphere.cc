@@ -18,6 +18,7 @@
   === External declarations
   ===========================================================================*/
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <vector>
@@ -205,9 +206,7 @@ void AtmFieldPRegrid(  // WS Generic Output:
       (ing_max - ing_min + 1 != p_grid_new.nelem()),
       "New grid seems not to be sufficiently covered by old grid.\n")
 
-  for (Index i = 0; i < atmtensor_in.nrows(); i++)
-    for (Index j = 0; j < atmtensor_in.ncols(); j++)
-      reinterp(atmtensor_out(joker, i, j), atmtensor_in(joker, i, j), itw, lag_p);
+  reinterp_leading_dim(atmtensor_out, atmtensor_in, itw, lag_p);
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -256,12 +255,10 @@ void AtmFieldPRegrid(  // WS Generic Output:
     "New grid seems not to be sufficiently covered by old grid.\n")
 
   for (Index b = 0; b < atmtensor_in.nbooks(); b++)
-    for (Index i = 0; i < atmtensor_in.nrows(); i++)
-      for (Index j = 0; j < atmtensor_in.ncols(); j++)
-        reinterp(atmtensor_out(b, joker, i, j),
-                 atmtensor_in(b, joker, i, j),
-                 itw,
-                 lag_p);
+    reinterp_leading_dim(atmtensor_out(b, joker, joker, joker),
+                         atmtensor_in(b, joker, joker, joker),
+                         itw,
+                         lag_p);
 }
 
 //! Check for correct grid dimensions
@@ -657,6 +654,38 @@ void GriddedFieldPRegridHelper(Index& ing_min,
   }
 }
 
+//! Pressure interpolation of a 3D field with precalculated weights
+/*
+ The output is zero outside the range [ing_min, ing_max]. The work is
+ distributed over the latitude rows, each row sees the same summation order
+ as a single call on the full field.
+
+ \param[out]    out           Output data, sized to the new pressure grid
+ \param[in]     in            Input data
+ \param[in]     ing_min       As returned by GriddedFieldPRegridHelper
+ \param[in]     ing_max       As returned by GriddedFieldPRegridHelper
+ \param[in]     lag_p         As returned by GriddedFieldPRegridHelper
+ \param[in]     itw           As returned by GriddedFieldPRegridHelper
+ */
+void GriddedFieldPRegridData(Tensor3View out,
+                             const ConstTensor3View& in,
+                             const Index ing_min,
+                             const Index ing_max,
+                             const ArrayOfLagrangeLogInterpolation& lag_p,
+                             const Matrix& itw) {
+  const Index nelem_in_range = ing_max - ing_min + 1;
+
+  if (nelem_in_range != out.npages()) out = 0.;
+  if (nelem_in_range <= 0) return;
+
+#pragma omp parallel for if (!arts_omp_in_parallel())
+  for (Index r = 0; r < in.nrows(); r++)
+    reinterp_leading_dim(out(Range(ing_min, nelem_in_range), r, joker),
+                         in(joker, r, joker),
+                         itw,
+                         lag_p);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void GriddedFieldPRegrid(  // WS Generic Output:
     GriddedField3& gfraw_out,
@@ -706,26 +735,8 @@ void GriddedFieldPRegrid(  // WS Generic Output:
                             verbosity);
 
   // Interpolate:
-  if (ing_max - ing_min < 0)
-    gfraw_out.data = 0.;
-  else if (ing_max - ing_min + 1 != p_grid.nelem()) {
-    gfraw_out.data = 0.;
-    for (Index i = 0; i < gfraw_in.data.nrows(); i++)
-      for (Index j = 0; j < gfraw_in.data.ncols(); j++) {
-        //                chk_interpolation_grids_loose_check_data(ing_min, ing_max,
-        //                                                         "Raw field to p_grid",
-        //                                                         gfraw_in.get_numeric_grid(p_grid_index),
-        //                                                         p_grid, gfraw_in.data(joker, i, j));
-        reinterp(gfraw_out.data(Range(ing_min, ing_max - ing_min + 1), i, j),
-                 gfraw_in.data(joker, i, j),
-                 itw,
-                 lag_p);
-      }
-  } else
-    for (Index i = 0; i < gfraw_in.data.nrows(); i++)
-      for (Index j = 0; j < gfraw_in.data.ncols(); j++)
-        reinterp(
-          gfraw_out.data(joker, i, j), gfraw_in.data(joker, i, j), itw, lag_p);
+  GriddedFieldPRegridData(
+      gfraw_out.data, gfraw_in.data, ing_min, ing_max, lag_p, itw);
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -785,26 +796,21 @@ void GriddedFieldPRegrid(  // WS Generic Output:
     gfraw_out.data = 0.;
   else if (ing_max - ing_min + 1 != p_grid.nelem()) {
     gfraw_out.data = 0.;
+#pragma omp parallel for if (!arts_omp_in_parallel())
     for (Index b = 0; b < gfraw_in.data.nbooks(); b++)
-      for (Index i = 0; i < gfraw_in.data.nrows(); i++)
-        for (Index j = 0; j < gfraw_in.data.ncols(); j++) {
-          //                    chk_interpolation_grids_loose_check_data(ing_min, ing_max,
-          //                                                             "Raw field to p_grid",
-          //                                                             gfraw_in.get_numeric_grid(p_grid_index),
-          //                                                             p_grid, gfraw_in.data(b, joker, i, j));
-          reinterp(gfraw_out.data(b, Range(ing_min, ing_max - ing_min), i, j),
-                   gfraw_in.data(b, joker, i, j),
-                   itw,
-                   lag_p);
-        }
-  } else
+      reinterp_leading_dim(
+          gfraw_out.data(b, Range(ing_min, ing_max - ing_min), joker, joker),
+          gfraw_in.data(b, joker, joker, joker),
+          itw,
+          lag_p);
+  } else {
+#pragma omp parallel for if (!arts_omp_in_parallel())
     for (Index b = 0; b < gfraw_in.data.nbooks(); b++)
-      for (Index i = 0; i < gfraw_in.data.nrows(); i++)
-        for (Index j = 0; j < gfraw_in.data.ncols(); j++)
-          reinterp(gfraw_out.data(b, joker, i, j),
-                   gfraw_in.data(b, joker, i, j),
-                   itw,
-                   lag_p);
+      reinterp_leading_dim(gfraw_out.data(b, joker, joker, joker),
+                           gfraw_in.data(b, joker, joker, joker),
+                           itw,
+                           lag_p);
+  }
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -817,16 +823,34 @@ void GriddedFieldPRegrid(  // WS Generic Output:
     const Index& interp_order,
     const Index& zeropadding,
     const Verbosity& verbosity) {
-  agfraw_out.resize(agfraw_in.nelem());
+  const Index nelem = agfraw_in.nelem();
+  agfraw_out.resize(nelem);
 
-  for (Index i = 0; i < agfraw_in.nelem(); i++) {
-    GriddedFieldPRegrid(agfraw_out[i],
-                        p_grid,
-                        agfraw_in[i],
-                        interp_order,
-                        zeropadding,
-                        verbosity);
+  String fail_msg;
+  bool failed = false;
+
+  // With fewer fields than threads the parallelisation is left to the
+  // per-field loop over latitudes
+#pragma omp parallel for if (!arts_omp_in_parallel() && \
+                             nelem >= arts_omp_get_max_threads())
+  for (Index i = 0; i < nelem; i++) {
+    try {
+      GriddedFieldPRegrid(agfraw_out[i],
+                          p_grid,
+                          agfraw_in[i],
+                          interp_order,
+                          zeropadding,
+                          verbosity);
+    } catch (const std::exception& e) {
+#pragma omp critical(GriddedFieldPRegrid_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
+    }
   }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg);
 }
 
 //! Calculate grid positions and interpolations weights for GriddedFieldLatLonRegrid
@@ -892,6 +916,62 @@ void GriddedFieldLatLonRegridHelper(ArrayOfLagrangeInterpolation& lag_lat,
   itw = interpweights(lag_lat, lag_lon);
 }
 
+//! Check that a cyclic longitude grid has matching data at 0 and 360
+/*
+ \param[in]     gfraw_in   Input GriddedField with latitude and longitude as
+                            its second and third grid
+ */
+void chk_griddedfield3_lon_cyclic(const GriddedField3& gfraw_in) {
+  const Vector& in_grid0 = gfraw_in.get_numeric_grid(0);
+  const Vector& in_lat_grid = gfraw_in.get_numeric_grid(1);
+  const Vector& in_lon_grid = gfraw_in.get_numeric_grid(2);
+
+  if (is_lon_cyclic(in_lon_grid)) {
+    for (Index g0 = 0; g0 < in_grid0.nelem(); g0++)
+      for (Index lat = 0; lat < in_lat_grid.nelem(); lat++) {
+        ARTS_USER_ERROR_IF (!is_same_within_epsilon(
+                gfraw_in.data(g0, lat, 0),
+                gfraw_in.data(g0, lat, in_lon_grid.nelem() - 1),
+                EPSILON_LON_CYCLIC),
+             "Data values at 0 and 360 degrees for a cyclic longitude grid must match: \n"
+             , "Mismatch at 1st grid index    : " , g0 , " (" , in_grid0[g0]
+             , ")\n"
+             , "         at latitude index    : " , lat , " ("
+             , in_lat_grid[lat] , " degrees)\n"
+             , "Value at 0 degrees longitude  : " , gfraw_in.data(g0, lat, 0)
+             , "\n"
+             , "Value at 360 degrees longitude: "
+             , gfraw_in.data(g0, lat, in_lon_grid.nelem() - 1) , "\n"
+             , "Difference                    : "
+             , gfraw_in.data(g0, lat, in_lon_grid.nelem() - 1) -
+                    gfraw_in.data(g0, lat, 0)
+             , "\n"
+             , "Allowed difference            : " , EPSILON_LON_CYCLIC)
+      }
+  }
+}
+
+//! Latitude/longitude interpolation of a 3D field with precalculated weights
+/*
+ The work is distributed over the pages (the first dimension) of the field.
+
+ \param[out]    out       Output data, sized to the new lat/lon grids
+ \param[in]     in        Input data
+ \param[in]     lag_lat   As returned by GriddedFieldLatLonRegridHelper
+ \param[in]     lag_lon   As returned by GriddedFieldLatLonRegridHelper
+ \param[in]     itw       As returned by GriddedFieldLatLonRegridHelper
+ */
+void GriddedFieldLatLonRegridData(
+    Tensor3View out,
+    const ConstTensor3View& in,
+    const ArrayOfLagrangeInterpolation& lag_lat,
+    const ArrayOfLagrangeCyclic0to360Interpolation& lag_lon,
+    const Tensor4& itw) {
+#pragma omp parallel for if (!arts_omp_in_parallel())
+  for (Index i = 0; i < in.npages(); i++)
+    reinterp(out(i, joker, joker), in(i, joker, joker), itw, lag_lat, lag_lon);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void GriddedFieldLatLonRegrid(  // WS Generic Output:
     GriddedField2& gfraw_out,
@@ -1019,35 +1099,7 @@ void GriddedFieldLatLonRegrid(  // WS Generic Output:
   Tensor4 itw;
 
   // If lon grid is cyclic, the data values at 0 and 360 must match
-  const Vector& in_grid0 = gfraw_in.get_numeric_grid(0);
-  const Vector& in_lat_grid =
-      gfraw_in.get_numeric_grid(lat_grid_index);
-  const Vector& in_lon_grid =
-      gfraw_in.get_numeric_grid(lon_grid_index);
-
-  if (is_lon_cyclic(in_lon_grid)) {
-    for (Index g0 = 0; g0 < in_grid0.nelem(); g0++)
-      for (Index lat = 0; lat < in_lat_grid.nelem(); lat++) {
-        ARTS_USER_ERROR_IF (!is_same_within_epsilon(
-                gfraw_in.data(g0, lat, 0),
-                gfraw_in.data(g0, lat, in_lon_grid.nelem() - 1),
-                EPSILON_LON_CYCLIC),
-             "Data values at 0 and 360 degrees for a cyclic longitude grid must match: \n"
-             , "Mismatch at 1st grid index    : " , g0 , " (" , in_grid0[g0]
-             , ")\n"
-             , "         at latitude index    : " , lat , " ("
-             , in_lat_grid[lat] , " degrees)\n"
-             , "Value at 0 degrees longitude  : " , gfraw_in.data(g0, lat, 0)
-             , "\n"
-             , "Value at 360 degrees longitude: "
-             , gfraw_in.data(g0, lat, in_lon_grid.nelem() - 1) , "\n"
-             , "Difference                    : "
-             , gfraw_in.data(g0, lat, in_lon_grid.nelem() - 1) -
-                    gfraw_in.data(g0, lat, 0)
-             , "\n"
-             , "Allowed difference            : " , EPSILON_LON_CYCLIC)
-      }
-  }
+  chk_griddedfield3_lon_cyclic(gfraw_in);
 
   GriddedFieldLatLonRegridHelper(lag_lat,
                                  lag_lon,
@@ -1062,12 +1114,8 @@ void GriddedFieldLatLonRegrid(  // WS Generic Output:
                                  verbosity);
 
   // Interpolate:
-  for (Index i = 0; i < gfraw_in.data.npages(); i++)
-    reinterp(gfraw_out.data(i, joker, joker),
-             gfraw_in.data(i, joker, joker),
-             itw,
-             lag_lat,
-             lag_lon);
+  GriddedFieldLatLonRegridData(
+      gfraw_out.data, gfraw_in.data, lag_lat, lag_lon, itw);
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -1166,6 +1214,7 @@ void GriddedFieldLatLonRegrid(  // WS Generic Output:
   }
 
   // Interpolate:
+#pragma omp parallel for collapse(2) if (!arts_omp_in_parallel())
   for (Index i = 0; i < gfraw_in.data.nbooks(); i++)
     for (Index j = 0; j < gfraw_in.data.npages(); j++)
       reinterp(gfraw_out.data(i, j, joker, joker),
@@ -1185,16 +1234,237 @@ void GriddedFieldLatLonRegrid(  // WS Generic Output:
     const ArrayOfGriddedField3& agfraw_in,
     const Index& interp_order,
     const Verbosity& verbosity) {
-  agfraw_out.resize(agfraw_in.nelem());
+  const Index nelem = agfraw_in.nelem();
+  agfraw_out.resize(nelem);
 
-  for (Index i = 0; i < agfraw_in.nelem(); i++) {
-    GriddedFieldLatLonRegrid(agfraw_out[i],
-                             lat_true,
-                             lon_true,
-                             agfraw_in[i],
-                             interp_order,
-                             verbosity);
+  String fail_msg;
+  bool failed = false;
+
+  // With fewer fields than threads the parallelisation is left to the
+  // per-field loop over pages
+#pragma omp parallel for if (!arts_omp_in_parallel() && \
+                             nelem >= arts_omp_get_max_threads())
+  for (Index i = 0; i < nelem; i++) {
+    try {
+      GriddedFieldLatLonRegrid(agfraw_out[i],
+                               lat_true,
+                               lon_true,
+                               agfraw_in[i],
+                               interp_order,
+                               verbosity);
+    } catch (const std::exception& e) {
+#pragma omp critical(GriddedFieldLatLonRegrid_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
+    }
   }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg);
+}
+
+//! Regrid a set of 3D fields in latitude, longitude and pressure
+/*
+ The fields are first interpolated to the new latitude and longitude grids
+ and then to the new pressure grid, exactly as GriddedFieldLatLonRegrid
+ followed by GriddedFieldPRegrid does. Grid positions and interpolation
+ weights are calculated only once for each distinct set of raw grids, and
+ the interpolation is done in parallel, over the fields when there are
+ enough of them and otherwise inside each field.
+
+ \param[out]    gfraw_out     Regridded fields
+ \param[in]     gfraw_in      Raw input fields
+ \param[in]     zeropadding   Apply zero-padding, one value per field
+ \param[in]     p_grid        New pressure grid
+ \param[in]     lat_true      New latitude grid
+ \param[in]     lon_true      New longitude grid
+ \param[in]     interp_order  Interpolation order
+ \param[in]     verbosity     Verbosity levels
+ */
+void GriddedFieldLatLonPRegridFields(
+    ArrayOfGriddedField3& gfraw_out,
+    const std::vector<const GriddedField3*>& gfraw_in,
+    const ArrayOfIndex& zeropadding,
+    const Vector& p_grid,
+    const Vector& lat_true,
+    const Vector& lon_true,
+    const Index& interp_order,
+    const Verbosity& verbosity) {
+  const Index nfields = static_cast<Index>(gfraw_in.size());
+  ARTS_ASSERT(zeropadding.nelem() == nfields);
+
+  struct LatLonWeights {
+    const GriddedField3* gfraw;
+    ArrayOfLagrangeInterpolation lag_lat;
+    ArrayOfLagrangeCyclic0to360Interpolation lag_lon;
+    Tensor4 itw;
+  };
+  struct PWeights {
+    const GriddedField3* gfraw;
+    Index zeropadding;
+    Index ing_min;
+    Index ing_max;
+    ArrayOfLagrangeLogInterpolation lag_p;
+    Matrix itw;
+  };
+  std::vector<LatLonWeights> latlon_weights;
+  std::vector<PWeights> p_weights;
+  ArrayOfIndex latlon_index(nfields), p_index(nfields);
+
+  gfraw_out.resize(nfields);
+
+  // Checks, output grids and interpolation weights. Serial, since new
+  // weights are only calculated for grids not seen before
+  for (Index i = 0; i < nfields; i++) {
+    const GriddedField3& gfraw = *gfraw_in[i];
+    GriddedField3& gfout = gfraw_out[i];
+
+    ARTS_USER_ERROR_IF (gfraw.get_grid_size(1) < 2 ||
+        gfraw.get_grid_size(2) < 2,
+        "Raw data has to be true 3D data (nlat>1 and nlon>1).\n"
+        "Use GriddedFieldLatLonExpand to convert 1D or 2D data to 3D!\n")
+
+    chk_griddedfield3_lon_cyclic(gfraw);
+
+    const auto same_latlon = std::find_if(
+        latlon_weights.cbegin(),
+        latlon_weights.cend(),
+        [&gfraw](const LatLonWeights& w) {
+          return w.gfraw->get_numeric_grid(1) == gfraw.get_numeric_grid(1) &&
+                 w.gfraw->get_numeric_grid(2) == gfraw.get_numeric_grid(2);
+        });
+    if (same_latlon == latlon_weights.cend()) {
+      LatLonWeights& w = latlon_weights.emplace_back();
+      w.gfraw = &gfraw;
+      GriddedFieldLatLonRegridHelper(w.lag_lat,
+                                     w.lag_lon,
+                                     w.itw,
+                                     gfout,
+                                     gfraw,
+                                     1,
+                                     2,
+                                     lat_true,
+                                     lon_true,
+                                     interp_order,
+                                     verbosity);
+      latlon_index[i] = static_cast<Index>(latlon_weights.size()) - 1;
+    } else {
+      chk_griddedfield_gridname(gfraw, 1, "Latitude");
+      chk_griddedfield_gridname(gfraw, 2, "Longitude");
+      gfout.set_grid(1, lat_true);
+      gfout.set_grid_name(1, gfraw.get_grid_name(1));
+      gfout.set_grid(2, lon_true);
+      gfout.set_grid_name(2, gfraw.get_grid_name(2));
+      latlon_index[i] = same_latlon - latlon_weights.cbegin();
+    }
+
+    const auto same_p = std::find_if(
+        p_weights.cbegin(),
+        p_weights.cend(),
+        [&gfraw, zp = zeropadding[i]](const PWeights& w) {
+          return w.zeropadding == zp &&
+                 w.gfraw->get_numeric_grid(0) == gfraw.get_numeric_grid(0);
+        });
+    if (same_p == p_weights.cend()) {
+      PWeights& w = p_weights.emplace_back();
+      w.gfraw = &gfraw;
+      w.zeropadding = zeropadding[i];
+      GriddedFieldPRegridHelper(w.ing_min,
+                                w.ing_max,
+                                w.lag_p,
+                                w.itw,
+                                gfout,
+                                gfraw,
+                                0,
+                                p_grid,
+                                interp_order,
+                                w.zeropadding,
+                                verbosity);
+      p_index[i] = static_cast<Index>(p_weights.size()) - 1;
+    } else {
+      chk_griddedfield_gridname(gfraw, 0, "Pressure");
+      gfout.set_grid(0, p_grid);
+      gfout.set_grid_name(0, gfraw.get_grid_name(0));
+      p_index[i] = same_p - p_weights.cbegin();
+    }
+
+    gfout.data.resize(p_grid.nelem(), lat_true.nelem(), lon_true.nelem());
+  }
+
+  String fail_msg;
+  bool failed = false;
+
+  // Interpolate:
+#pragma omp parallel for if (!arts_omp_in_parallel() && \
+                             nfields >= arts_omp_get_max_threads())
+  for (Index i = 0; i < nfields; i++) {
+    try {
+      const LatLonWeights& wll = latlon_weights[latlon_index[i]];
+      const PWeights& wp = p_weights[p_index[i]];
+      const Tensor3& data_in = gfraw_in[i]->data;
+
+      Tensor3 data_latlon(data_in.npages(), lat_true.nelem(), lon_true.nelem());
+      GriddedFieldLatLonRegridData(
+          data_latlon, data_in, wll.lag_lat, wll.lag_lon, wll.itw);
+      GriddedFieldPRegridData(gfraw_out[i].data,
+                              data_latlon,
+                              wp.ing_min,
+                              wp.ing_max,
+                              wp.lag_p,
+                              wp.itw);
+    } catch (const std::exception& e) {
+#pragma omp critical(GriddedFieldLatLonPRegridFields_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void GriddedFieldLatLonPRegrid(  // WS Generic Output:
+    ArrayOfGriddedField3& agfraw_out,
+    // WS Input:
+    const Vector& p_grid,
+    const Vector& lat_true,
+    const Vector& lon_true,
+    // WS Generic Input:
+    const ArrayOfGriddedField3& agfraw_in_orig,
+    const Index& interp_order,
+    const Index& zeropadding,
+    const Verbosity& verbosity) {
+  ARTS_USER_ERROR_IF (!lat_true.nelem(),
+                      "The new latitude grid is not allowed to be empty.");
+  ARTS_USER_ERROR_IF (!lon_true.nelem(),
+                      "The new longitude grid is not allowed to be empty.");
+
+  const ArrayOfGriddedField3* agfraw_in_pnt;
+  ArrayOfGriddedField3 agfraw_in_copy;
+
+  if (&agfraw_in_orig == &agfraw_out) {
+    agfraw_in_copy = agfraw_in_orig;
+    agfraw_in_pnt = &agfraw_in_copy;
+  } else
+    agfraw_in_pnt = &agfraw_in_orig;
+
+  const ArrayOfGriddedField3& agfraw_in = *agfraw_in_pnt;
+
+  std::vector<const GriddedField3*> fields;
+  fields.reserve(agfraw_in.size());
+  for (auto& gfraw : agfraw_in) fields.push_back(&gfraw);
+
+  GriddedFieldLatLonPRegridFields(agfraw_out,
+                                  fields,
+                                  ArrayOfIndex(agfraw_in.nelem(), zeropadding),
+                                  p_grid,
+                                  lat_true,
+                                  lon_true,
+                                  interp_order,
+                                  verbosity);
 }
 
 //! Calculate grid positions and interpolations weights for GriddedFieldZToPRegrid
@@ -2198,64 +2468,54 @@ void AtmFieldsCalc(  //WS Output:
           "Raw data has wrong dimension. You have to use \n"
           "AtmFieldsCalcExpand1D instead of AtmFieldsCalc.");
 
-    GriddedField3 temp_gfield3;
-
-    GriddedFieldLatLonRegrid(
-        temp_gfield3, lat_grid, lon_grid, t_field_raw, interp_order, verbosity);
-    GriddedFieldPRegrid(
-        temp_gfield3, p_grid, temp_gfield3, interp_order, 0, verbosity);
-    t_field = temp_gfield3.data;
-
-    GriddedFieldLatLonRegrid(
-        temp_gfield3, lat_grid, lon_grid, z_field_raw, interp_order, verbosity);
-    GriddedFieldPRegrid(
-        temp_gfield3, p_grid, temp_gfield3, interp_order, 0, verbosity);
-    z_field = temp_gfield3.data;
+    // All fields are regridded in one go, sharing the interpolation weights
+    // between fields with the same raw grids
+    std::vector<const GriddedField3*> fields{&t_field_raw, &z_field_raw};
+    ArrayOfIndex zeropadding{0, 0};
+    for (auto& gfraw : vmr_field_raw) {
+      fields.push_back(&gfraw);
+      zeropadding.push_back(vmr_zeropadding);
+    }
+    for (auto& gfraw : nlte_field_raw) {
+      fields.push_back(&gfraw);
+      zeropadding.push_back(0);
+    }
 
     ArrayOfGriddedField3 temp_agfield3;
-    GriddedFieldLatLonRegrid(temp_agfield3,
-                             lat_grid,
-                             lon_grid,
-                             vmr_field_raw,
-                             interp_order,
-                             verbosity);
     try {
-      GriddedFieldPRegrid(temp_agfield3,
-                          p_grid,
-                          temp_agfield3,
-                          interp_order,
-                          vmr_zeropadding,
-                          verbosity);
+      GriddedFieldLatLonPRegridFields(temp_agfield3,
+                                      fields,
+                                      zeropadding,
+                                      p_grid,
+                                      lat_grid,
+                                      lon_grid,
+                                      interp_order,
+                                      verbosity);
     } catch (const std::runtime_error& e) {
       ARTS_USER_ERROR (
         e.what(), "\n"
-        "Note that you can explicitly set vmr_zeropadding "
+        "Note that for VMR fields you can explicitly set vmr_zeropadding "
         "to 1 in the method call.")
     }
+
+    t_field = std::move(temp_agfield3[0].data);
+    z_field = std::move(temp_agfield3[1].data);
+
+    const Index nvmr = vmr_field_raw.nelem();
+    ArrayOfGriddedField3 temp_vmr(nvmr);
+    for (Index i = 0; i < nvmr; i++)
+      temp_vmr[i] = std::move(temp_agfield3[2 + i]);
     FieldFromGriddedField(
-        vmr_field, p_grid, lat_grid, lon_grid, temp_agfield3, verbosity);
+        vmr_field, p_grid, lat_grid, lon_grid, temp_vmr, verbosity);
 
     if (nlte_field_raw.nelem()) {
-      GriddedFieldLatLonRegrid(temp_agfield3,
-                               lat_grid,
-                               lon_grid,
-                               nlte_field_raw,
-                               interp_order,
-                               verbosity);
-      
-      try {
-        GriddedFieldPRegrid(
-          temp_agfield3, p_grid, temp_agfield3, interp_order, 0, verbosity);
-      } catch (const std::runtime_error& e) {
-        ARTS_USER_ERROR ( e.what(), "\n"
-          "Note that you can explicitly set vmr_zeropadding "
-          "to 1 in the method call.")
-      }
-      
-      if (nlte_ids.nelem() == nlte_field_raw.nelem())
+      if (nlte_ids.nelem() == nlte_field_raw.nelem()) {
+        ArrayOfGriddedField3 temp_nlte(nlte_field_raw.nelem());
+        for (Index i = 0; i < nlte_field_raw.nelem(); i++)
+          temp_nlte[i] = std::move(temp_agfield3[2 + nvmr + i]);
         FieldFromGriddedField(
-          nlte_field.value, p_grid, lat_grid, lon_grid, temp_agfield3, verbosity);
-      else
+          nlte_field.value, p_grid, lat_grid, lon_grid, temp_nlte, verbosity);
+      } else
         nlte_field.value.resize(0, 0, 0, 0);
     }
   } else {
@@ -18,12 +18,15 @@
   ===========================================================================*/
 
 #include <cmath>
+#include <memory>
 #include "gridded_fields.h"
 using namespace std;
 
 #include "arts.h"
 #include "arts_omp.h"
 #include "auto_md.h"
+#include "batch.h"
+#include "file.h"
 #include "math_funcs.h"
 #include "physics_funcs.h"
 #include "rte.h"
@@ -69,13 +72,14 @@ void ybatchCalc(Workspace& ws,
                 const Agenda& ybatch_calc_agenda,
                 // Control Parameters:
                 const Index& robust,
+                const String& filename,
+                const Index& chunk_size,
+                const Index& resume,
+                const Vector& cost,
+                const Index& max_parallel_jobs,
+                const Index& nthreads_per_job,
                 const Verbosity& verbosity) {
-  CREATE_OUTS;
-
-  Index first_ybatch_index = 0;
-
-  ArrayOfString fail_msg;
-  bool do_abort = false;
+  CREATE_OUT1;
 
   // We allow a start index ybatch_start that is different from 0. We
   // will calculate ybatch_n jobs starting at the start
@@ -84,132 +88,151 @@ void ybatchCalc(Workspace& ws,
   // ybatch_calc_agenda, we add ybatch_start to the internal index
   // count.
 
-  // We create a counter, so that we can generate nice output about
-  // how many jobs are already done. (All parallel threads later will
-  // increment this, so that we really get an accurate total count!)
-  Index job_counter = 0;
-
-  // Resize the output arrays:
-  ybatch.resize(ybatch_n);
-  ybatch_aux.resize(ybatch_n);
-  ybatch_jacobians.resize(ybatch_n);
-  for (Index i = 0; i < ybatch_n; i++) {
-    ybatch[i].resize(0);
-    ybatch_aux[i].resize(0);
-    ybatch_jacobians[i].resize(0, 0);
+  // Results are either streamed to file, or kept in the output arrays. With
+  // MPI, the file is written by the root process, and the other processes
+  // only keep their results until sent to it.
+  std::unique_ptr<YBatchSink> sink;
+  if (filename.nelem() and batch_mpi_rank() == 0) {
+    sink = std::make_unique<YBatchSink>(filename,
+                                        ybatch_start,
+                                        ybatch_n,
+                                        chunk_size,
+                                        resume,
+                                        2 * arts_omp_get_max_threads(),
+                                        verbosity);
+    if (const Index ndone = sink->ndone(); ndone)
+      out1 << "  Skipping " << ndone << " jobs already written to file.\n";
+
+    ybatch.resize(0);
+    ybatch_aux.resize(0);
+    ybatch_jacobians.resize(0);
+  } else {
+    // Resize the output arrays:
+    ybatch.resize(ybatch_n);
+    ybatch_aux.resize(ybatch_n);
+    ybatch_jacobians.resize(ybatch_n);
+    for (Index i = 0; i < ybatch_n; i++) {
+      ybatch[i].resize(0);
+      ybatch_aux[i].resize(0);
+      ybatch_jacobians[i].resize(0, 0);
+    }
   }
 
-  // Go through the batch:
-
-  if (ybatch_n) {
-  WorkspaceOmpParallelCopyGuard wss{ws};
-
-#pragma omp parallel for schedule(dynamic) if (!arts_omp_in_parallel() && \
-                                               ybatch_n > 1) firstprivate(wss)
-    for (Index ybatch_index = first_ybatch_index; ybatch_index < ybatch_n;
-         ybatch_index++) {
-      Index l_job_counter;  // Thread-local copy of job counter.
-
-      if (do_abort) continue;
-#pragma omp critical(ybatchCalc_job_counter)
-      { l_job_counter = ++job_counter; }
-
-      {
-        ostringstream os;
-        os << "  Job " << l_job_counter << " of " << ybatch_n << ", Index "
-           << ybatch_start + ybatch_index << ", Thread-Id "
-           << arts_omp_get_thread_num() << "\n";
-        out2 << os.str();
-      }
-
-      try {
-        Vector y;
-        ArrayOfVector y_aux;
-        Matrix jacobian;
-
-        ybatch_calc_agendaExecute(wss,
-                                  y,
-                                  y_aux,
-                                  jacobian,
-                                  ybatch_start + ybatch_index,
-                                  ybatch_calc_agenda);
-
-        if (y.nelem()) {
-#pragma omp critical(ybatchCalc_assign_y)
-          ybatch[ybatch_index] = y;
-#pragma omp critical(ybatchCalc_assign_y_aux)
-          ybatch_aux[ybatch_index] = y_aux;
-
-          // Dimensions of Jacobian:
-          const Index Knr = jacobian.nrows();
-          const Index Knc = jacobian.ncols();
-
-          if (Knr != 0 || Knc != 0) {
-            if (Knr != y.nelem()) {
-              ostringstream os;
-              os << "First dimension of Jacobian must have same length as the measurement *y*.\n"
-                 << "Length of *y*: " << y.nelem() << "\n"
-                 << "Dimensions of *jacobian*: (" << Knr << ", " << Knc
-                 << ")\n";
-              // A mismatch of the Jacobian dimension is a fatal error
-              // and should result in program termination. By setting abort
-              // to true, this will result in a runtime error in the catch
-              // block even if robust == 1
-#pragma omp critical(ybatchCalc_setabort)
-              do_abort = true;
-
-              throw runtime_error(os.str());
-            }
-
-            ybatch_jacobians[ybatch_index] = jacobian;
-
-            // After creation, all individual Jacobi matrices in the array will be
-            // empty (size zero). No need for explicit initialization.
-          }
-        }
-      } catch (const std::exception& e) {
-        if (robust && !do_abort) {
-          ostringstream os;
-          os << "WARNING! Job at ybatch_index " << ybatch_start + ybatch_index
-             << " failed.\n"
-             << "y Vector in output variable ybatch will be empty for this job.\n"
-             << "The runtime error produced was:\n"
-             << e.what() << "\n";
-          out0 << os.str();
-        } else {
-          // The user wants the batch job to fail if one of the
-          // jobs goes wrong.
-#pragma omp critical(ybatchCalc_setabort)
-          do_abort = true;
-
-          ostringstream os;
-          os << "  Job at ybatch_index " << ybatch_start + ybatch_index
-             << " failed. Aborting...\n";
-          out1 << os.str();
-        }
+  // Each job has its own element of the output arrays, so no
+  // synchronisation is needed here
+  const auto store = [&](const Index ybatch_index,
+                         Vector&& y,
+                         ArrayOfVector&& y_aux,
+                         Matrix&& jacobian) {
+    if (sink) {
+      sink->push(
+          ybatch_index, std::move(y), std::move(y_aux), std::move(jacobian));
+    } else if (y.nelem()) {
+      ybatch[ybatch_index] = std::move(y);
+      ybatch_aux[ybatch_index] = std::move(y_aux);
+
+      // After creation, all individual Jacobi matrices in the array will be
+      // empty (size zero). No need for explicit initialization.
+      if (jacobian.nrows() != 0 || jacobian.ncols() != 0)
+        ybatch_jacobians[ybatch_index] = std::move(jacobian);
+    }
+  };
+
+  BatchJobs jobs;
+
+  jobs.calc = [&](Workspace& wsj, const Index ybatch_index) {
+    Vector y;
+    ArrayOfVector y_aux;
+    Matrix jacobian;
+
+    ybatch_calc_agendaExecute(wsj,
+                              y,
+                              y_aux,
+                              jacobian,
+                              ybatch_start + ybatch_index,
+                              ybatch_calc_agenda);
+
+    if (y.nelem()) {
+      // Dimensions of Jacobian:
+      const Index Knr = jacobian.nrows();
+      const Index Knc = jacobian.ncols();
+
+      // A mismatch of the Jacobian dimension is a fatal error
+      // and should result in program termination, even if robust == 1
+      if ((Knr != 0 || Knc != 0) && Knr != y.nelem()) {
         ostringstream os;
-        os << "Run-time error at ybatch_index " << ybatch_start + ybatch_index
-           << ": \n"
-           << e.what();
-#pragma omp critical(ybatchCalc_push_fail_msg)
-        fail_msg.push_back(os.str());
+        os << "First dimension of Jacobian must have same length as the measurement *y*.\n"
+           << "Length of *y*: " << y.nelem() << "\n"
+           << "Dimensions of *jacobian*: (" << Knr << ", " << Knc << ")\n";
+        throw BatchAbort(os.str());
       }
+    } else {
+      // Nothing is stored for jobs without a spectrum
+      y_aux.resize(0);
+      jacobian.resize(0, 0);
     }
-  }
-
-  if (fail_msg.nelem()) {
-    ostringstream os;
-
-    if (!do_abort) os << "\nError messages from failed batch cases:\n";
-    for (ArrayOfString::const_iterator it = fail_msg.begin();
-         it != fail_msg.end();
-         it++)
-      os << *it << '\n';
 
-    if (do_abort)
-      throw runtime_error(os.str());
-    else
-      out0 << os.str();
+    store(ybatch_index, std::move(y), std::move(y_aux), std::move(jacobian));
+  };
+
+  if (sink)
+    jobs.skip = [&](const Index ybatch_index) {
+      return sink->is_done(ybatch_index);
+    };
+
+  // An empty result completes the chunk of a failed job
+  jobs.on_failure = [&](const Index ybatch_index) {
+    if (sink) sink->push(ybatch_index, Vector{}, ArrayOfVector{}, Matrix{});
+  };
+  jobs.failure_note =
+      "y Vector in output variable ybatch will be empty for this job.";
+
+  jobs.pack = [&](const Index ybatch_index, std::vector<Numeric>& buffer) {
+    batch_pack(buffer, ybatch[ybatch_index]);
+    batch_pack(buffer, ybatch_aux[ybatch_index]);
+    batch_pack(buffer, ybatch_jacobians[ybatch_index]);
+    ybatch[ybatch_index] = Vector{};
+    ybatch_aux[ybatch_index] = ArrayOfVector{};
+    ybatch_jacobians[ybatch_index] = Matrix{};
+  };
+
+  jobs.unpack = [&](const Index ybatch_index,
+                    const std::vector<Numeric>& buffer,
+                    std::size_t& pos) {
+    Vector y;
+    ArrayOfVector y_aux;
+    Matrix jacobian;
+    batch_unpack(buffer, pos, y);
+    batch_unpack(buffer, pos, y_aux);
+    batch_unpack(buffer, pos, jacobian);
+    store(ybatch_index, std::move(y), std::move(y_aux), std::move(jacobian));
+  };
+
+  // Write out all complete chunks, also if the batch is aborted, so
+  // that a rerun can continue from there
+  jobs.finish = [&]() {
+    if (sink) sink->finish();
+  };
+
+  BatchSettings settings;
+  settings.ybatch_start = ybatch_start;
+  settings.robust = robust;
+  settings.cost = cost;
+  settings.max_parallel_jobs = max_parallel_jobs;
+  settings.nthreads_per_job = nthreads_per_job;
+
+  batch_run(ws, ybatch_n, settings, jobs, verbosity);
+
+  if (filename.nelem()) {
+    // The other MPI processes only kept their results until sent
+    ybatch.resize(0);
+    ybatch_aux.resize(0);
+    ybatch_jacobians.resize(0);
+  } else {
+    // With MPI, all processes end up with the results
+    batch_mpi_share(ybatch);
+    batch_mpi_share(ybatch_aux);
+    batch_mpi_share(ybatch_jacobians);
   }
 }
 
@@ -637,13 +660,12 @@ void DOBatchCalc(Workspace& ws,
                  const Index& ybatch_n,
                  const Agenda& dobatch_calc_agenda,
                  const Index& robust,
+                 const String& checkpoint,
+                 const Vector& cost,
+                 const Index& max_parallel_jobs,
+                 const Index& nthreads_per_job,
                  const Verbosity& verbosity) {
-  CREATE_OUTS;
-
-  Index first_ybatch_index = 0;
-
-  ArrayOfString fail_msg;
-  bool do_abort = false;
+  CREATE_OUT1;
 
   // We allow a start index ybatch_start that is different from 0. We
   // will calculate ybatch_n jobs starting at the start
@@ -652,106 +674,125 @@ void DOBatchCalc(Workspace& ws,
   // ybatch_calc_agenda, we add ybatch_start to the internal index
   // count.
 
-  // We create a counter, so that we can generate nice output about
-  // how many jobs are already done. (All parallel threads later will
-  // increment this, so that we really get an accurate total count!)
-  Index job_counter = 0;
-
   // Resize the output arrays:
   dobatch_cloudbox_field.resize(ybatch_n);
   dobatch_radiance_field.resize(ybatch_n);
   dobatch_irradiance_field.resize(ybatch_n);
   dobatch_spectral_irradiance_field.resize(ybatch_n);
 
-  // Go through the batch:
-
-  if (ybatch_n) {
-  WorkspaceOmpParallelCopyGuard wss{ws};
-  
-#pragma omp parallel for schedule(dynamic) if (!arts_omp_in_parallel() && \
-                                               ybatch_n > 1) firstprivate(wss)
-    for (Index ybatch_index = first_ybatch_index; ybatch_index < ybatch_n;
-         ybatch_index++) {
-      Index l_job_counter;  // Thread-local copy of job counter.
-
-      if (do_abort) continue;
-#pragma omp critical(dobatchCalc_job_counter)
-      { l_job_counter = ++job_counter; }
-
-      {
-        ostringstream os;
-        os << "  Job " << l_job_counter << " of " << ybatch_n << ", Index "
-           << ybatch_start + ybatch_index << ", Thread-Id "
-           << arts_omp_get_thread_num() << "\n";
-        out2 << os.str();
-      }
-
-      try {
-        Tensor7 cloudbox_field;
-        Tensor5 radiance_field;
-        Tensor4 irradiance_field;
-        Tensor5 spectral_irradiance_field;
-
-        dobatch_calc_agendaExecute(wss,
-                                   cloudbox_field,
-                                   radiance_field,
-                                   irradiance_field,
-                                   spectral_irradiance_field,
-                                   ybatch_start + ybatch_index,
-                                   dobatch_calc_agenda);
-
-#pragma omp critical(dobatchCalc_assign_cloudbox_field)
-        dobatch_cloudbox_field[ybatch_index] = cloudbox_field;
-#pragma omp critical(dobatchCalc_assign_radiance_field)
-        dobatch_radiance_field[ybatch_index] = radiance_field;
-#pragma omp critical(dobatchCalc_assign_irradiance_field)
-        dobatch_irradiance_field[ybatch_index] = irradiance_field;
-#pragma omp critical(dobatchCalc_assign_spectral_irradiance_field)
-        dobatch_spectral_irradiance_field[ybatch_index] =
-            spectral_irradiance_field;
-
-      } catch (const std::exception& e) {
-        if (robust && !do_abort) {
-          ostringstream os;
-          os << "WARNING! Job at ybatch_index " << ybatch_start + ybatch_index
-             << " failed.\n"
-             << "element in output variables will be empty for this job.\n"
-             << "The runtime error produced was:\n"
-             << e.what() << "\n";
-          out0 << os.str();
-        } else {
-          // The user wants the batch job to fail if one of the
-          // jobs goes wrong.
-#pragma omp critical(dobatchCalc_setabort)
-          do_abort = true;
-
-          ostringstream os;
-          os << "  Job at ybatch_index " << ybatch_start + ybatch_index
-             << " failed. Aborting...\n";
-          out1 << os.str();
-        }
-        ostringstream os;
-        os << "Run-time error at ybatch_index " << ybatch_start + ybatch_index
-           << ": \n"
-           << e.what();
-#pragma omp critical(dobatchCalc_push_fail_msg)
-        fail_msg.push_back(os.str());
-      }
+  // Each finished job is saved to its own set of files, the spectral
+  // irradiance file is written last and marks the job as complete
+  const auto checkpoint_filename = [&](const Index ybatch_index,
+                                       const String& name) {
+    return var_string(
+        checkpoint, '.', ybatch_start + ybatch_index, '.', name, ".xml");
+  };
+
+  // Jobs saved by an earlier run are read back instead of calculated. With
+  // MPI, this is done by the root process, which holds the results.
+  ArrayOfIndex done(ybatch_n, 0);
+  if (checkpoint.nelem() and batch_mpi_rank() == 0) {
+    Index ndone = 0;
+    for (Index i = 0; i < ybatch_n; i++) {
+      if (!file_exists(add_basedir(
+              checkpoint_filename(i, "dobatch_spectral_irradiance_field"))))
+        continue;
+
+      xml_read_from_file(checkpoint_filename(i, "dobatch_cloudbox_field"),
+                         dobatch_cloudbox_field[i],
+                         verbosity);
+      xml_read_from_file(checkpoint_filename(i, "dobatch_radiance_field"),
+                         dobatch_radiance_field[i],
+                         verbosity);
+      xml_read_from_file(checkpoint_filename(i, "dobatch_irradiance_field"),
+                         dobatch_irradiance_field[i],
+                         verbosity);
+      xml_read_from_file(
+          checkpoint_filename(i, "dobatch_spectral_irradiance_field"),
+          dobatch_spectral_irradiance_field[i],
+          verbosity);
+      done[i] = 1;
+      ndone++;
     }
+    if (ndone)
+      out1 << "  Skipping " << ndone << " jobs read from checkpoint files.\n";
   }
 
-  if (fail_msg.nelem()) {
-    ostringstream os;
-
-    if (!do_abort) os << "\nError messages from failed batch cases:\n";
-    for (ArrayOfString::const_iterator it = fail_msg.begin();
-         it != fail_msg.end();
-         it++)
-      os << *it << '\n';
-
-    if (do_abort)
-      throw runtime_error(os.str());
-    else
-      out0 << os.str();
-  }
+  BatchJobs jobs;
+
+  jobs.calc = [&](Workspace& wsj, const Index ybatch_index) {
+    dobatch_calc_agendaExecute(wsj,
+                               dobatch_cloudbox_field[ybatch_index],
+                               dobatch_radiance_field[ybatch_index],
+                               dobatch_irradiance_field[ybatch_index],
+                               dobatch_spectral_irradiance_field[ybatch_index],
+                               ybatch_start + ybatch_index,
+                               dobatch_calc_agenda);
+
+    if (checkpoint.nelem()) {
+      xml_write_to_file_atomic(
+          checkpoint_filename(ybatch_index, "dobatch_cloudbox_field"),
+          dobatch_cloudbox_field[ybatch_index],
+          verbosity);
+      xml_write_to_file_atomic(
+          checkpoint_filename(ybatch_index, "dobatch_radiance_field"),
+          dobatch_radiance_field[ybatch_index],
+          verbosity);
+      xml_write_to_file_atomic(
+          checkpoint_filename(ybatch_index, "dobatch_irradiance_field"),
+          dobatch_irradiance_field[ybatch_index],
+          verbosity);
+      xml_write_to_file_atomic(
+          checkpoint_filename(ybatch_index,
+                              "dobatch_spectral_irradiance_field"),
+          dobatch_spectral_irradiance_field[ybatch_index],
+          verbosity);
+    }
+  };
+
+  jobs.skip = [&](const Index ybatch_index) { return done[ybatch_index]; };
+
+  const auto clear = [&](const Index ybatch_index) {
+    dobatch_cloudbox_field[ybatch_index] = Tensor7{};
+    dobatch_radiance_field[ybatch_index] = Tensor5{};
+    dobatch_irradiance_field[ybatch_index] = Tensor4{};
+    dobatch_spectral_irradiance_field[ybatch_index] = Tensor5{};
+  };
+
+  // Partial results of a failed job are not kept
+  jobs.on_failure = clear;
+  jobs.failure_note =
+      "element in output variables will be empty for this job.";
+
+  jobs.pack = [&](const Index ybatch_index, std::vector<Numeric>& buffer) {
+    batch_pack(buffer, dobatch_cloudbox_field[ybatch_index]);
+    batch_pack(buffer, dobatch_radiance_field[ybatch_index]);
+    batch_pack(buffer, dobatch_irradiance_field[ybatch_index]);
+    batch_pack(buffer, dobatch_spectral_irradiance_field[ybatch_index]);
+    clear(ybatch_index);
+  };
+
+  jobs.unpack = [&](const Index ybatch_index,
+                    const std::vector<Numeric>& buffer,
+                    std::size_t& pos) {
+    batch_unpack(buffer, pos, dobatch_cloudbox_field[ybatch_index]);
+    batch_unpack(buffer, pos, dobatch_radiance_field[ybatch_index]);
+    batch_unpack(buffer, pos, dobatch_irradiance_field[ybatch_index]);
+    batch_unpack(buffer, pos, dobatch_spectral_irradiance_field[ybatch_index]);
+  };
+
+  BatchSettings settings;
+  settings.ybatch_start = ybatch_start;
+  settings.robust = robust;
+  settings.cost = cost;
+  settings.max_parallel_jobs = max_parallel_jobs;
+  settings.nthreads_per_job = nthreads_per_job;
+
+  batch_run(ws, ybatch_n, settings, jobs, verbosity);
+
+  // With MPI, all processes end up with the results
+  batch_mpi_share(dobatch_cloudbox_field);
+  batch_mpi_share(dobatch_radiance_field);
+  batch_mpi_share(dobatch_irradiance_field);
+  batch_mpi_share(dobatch_spectral_irradiance_field);
 }
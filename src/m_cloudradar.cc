@@ -210,10 +210,6 @@ void iyRadarSingleScat(Workspace& ws,
   //  Matrix scalar_ext(np,nf,0);  // Only used for iy_aux
   const Index nf_ssd = scat_data[0][0].pha_mat_data.nlibraries();
   const Index duplicate_freqs = ((nf == nf_ssd) ? 0 : 1);
-  Tensor6 pha_mat_1se(nf_ssd, 1, 1, 1, ns, ns);
-  Vector t_ok(1), t_array(1);
-  Matrix mlos_sca(1, 2), mlos_inc(1, 2);
-  Index ptype;
   EnergyLevelMap ppvar_nlte;
 
   if (np == 1 && rbi == 1) {  // i.e. ppath is totally outside the atmosphere:
@@ -265,13 +261,15 @@ void iyRadarSingleScat(Workspace& ws,
     }
 
     // Size radiative variables always used
-    PropagationMatrix K_this(nf, ns), K_past(nf, ns), Kp(nf, ns);
+    ArrayOfPropagationMatrix K(np, PropagationMatrix(nf, ns));
+    PropagationMatrix Kp(nf, ns);
     StokesVector a(nf, ns), S(nf, ns);
     ArrayOfIndex lte(np);
 
     // Init variables only used if transmission part of jacobian
     Vector dB_dT(0);
-    ArrayOfPropagationMatrix dK_this_dx(0), dK_past_dx(0), dKp_dx(0);
+    ArrayOfArrayOfPropagationMatrix dK_dx(np);
+    ArrayOfPropagationMatrix dKp_dx(0);
     ArrayOfStokesVector da_dx(0), dS_dx(0);
 
     // HSE variables
@@ -279,15 +277,15 @@ void iyRadarSingleScat(Workspace& ws,
     bool do_hse = false;
 
     if (trans_in_jacobian && j_analytical_do) {
-      dK_this_dx.resize(nq);
-      dK_past_dx.resize(nq);
+      for (Index ip = 0; ip < np; ip++) {
+        dK_dx[ip].resize(nq);
+        FOR_ANALYTICAL_JACOBIANS_DO(dK_dx[ip][iq] = PropagationMatrix(nf, ns);)
+      }
       dKp_dx.resize(nq);
       da_dx.resize(nq);
       dS_dx.resize(nq);
       dB_dT.resize(nf);
       FOR_ANALYTICAL_JACOBIANS_DO(
-          dK_this_dx[iq] = PropagationMatrix(nf, ns);
-          dK_past_dx[iq] = PropagationMatrix(nf, ns);
           dKp_dx[iq] = PropagationMatrix(nf, ns);
           da_dx[iq] = StokesVector(nf, ns);
           dS_dx[iq] = StokesVector(nf, ns);
@@ -297,138 +295,170 @@ void iyRadarSingleScat(Workspace& ws,
           })
     }
 
+    ArrayOfString fail_msg;
+    bool do_abort = false;
+
+    WorkspaceOmpParallelCopyGuard wss{ws};
+
     // Loop ppath points and determine radiative properties
+#pragma omp parallel for if (!arts_omp_in_parallel()) \
+    firstprivate(wss, Kp, a, S, dKp_dx, da_dx, dS_dx)
     for (Index ip = 0; ip < np; ip++) {
-      get_stepwise_clearsky_propmat(ws,
-                                    K_this,
-                                    S,
-                                    lte[ip],
-                                    dK_this_dx,
-                                    dS_dx,
-                                    propmat_clearsky_agenda,
-                                    jacobian_quantities,
-                                    Vector{ppvar_f(joker, ip)},
-                                    Vector{ppvar_mag(joker, ip)},
-                                    Vector{ppath.los(ip, joker)},
-                                    ppvar_nlte[ip],
-                                    Vector{ppvar_vmr(joker, ip)},
-                                    ppvar_t[ip],
-                                    ppvar_p[ip],
-                                    trans_in_jacobian && j_analytical_do);
-
-      if (trans_in_jacobian && j_analytical_do)
-        adapt_stepwise_partial_derivatives(
-            dK_this_dx,
-            dS_dx,
-            jacobian_quantities,
-            ppvar_f(joker, ip),
-            ppath.los(ip, joker),
-            lte[ip],
-            atmosphere_dim,
-            trans_in_jacobian && j_analytical_do);
-
-      if (clear2cloudy[ip] + 1) {
-        get_stepwise_scattersky_propmat(a,
-                                        Kp,
-                                        da_dx,
-                                        dKp_dx,
-                                        jacobian_quantities,
-                                        ppvar_pnd(joker, Range(ip, 1)),
-                                        ppvar_dpnd_dx,
-                                        ip,
-                                        scat_data,
-                                        ppath.los(ip, joker),
-                                        ppvar_t[Range(ip, 1)],
-                                        atmosphere_dim,
-                                        trans_in_jacobian && jacobian_do);
-
-        if (abs(pext_scaling - 1) > 1e-6) {
-          Kp *= pext_scaling;
-          if (trans_in_jacobian && j_analytical_do) {
-            FOR_ANALYTICAL_JACOBIANS_DO(dKp_dx[iq] *= pext_scaling;)
+      if (do_abort) continue;
+      try {
+        get_stepwise_clearsky_propmat(wss,
+                                      K[ip],
+                                      S,
+                                      lte[ip],
+                                      dK_dx[ip],
+                                      dS_dx,
+                                      propmat_clearsky_agenda,
+                                      jacobian_quantities,
+                                      Vector{ppvar_f(joker, ip)},
+                                      Vector{ppvar_mag(joker, ip)},
+                                      Vector{ppath.los(ip, joker)},
+                                      ppvar_nlte[ip],
+                                      Vector{ppvar_vmr(joker, ip)},
+                                      ppvar_t[ip],
+                                      ppvar_p[ip],
+                                      trans_in_jacobian && j_analytical_do);
+
+        if (trans_in_jacobian && j_analytical_do)
+          adapt_stepwise_partial_derivatives(
+              dK_dx[ip],
+              dS_dx,
+              jacobian_quantities,
+              ppvar_f(joker, ip),
+              ppath.los(ip, joker),
+              lte[ip],
+              atmosphere_dim,
+              trans_in_jacobian && j_analytical_do);
+
+        if (clear2cloudy[ip] + 1) {
+          get_stepwise_scattersky_propmat(a,
+                                          Kp,
+                                          da_dx,
+                                          dKp_dx,
+                                          jacobian_quantities,
+                                          ppvar_pnd(joker, Range(ip, 1)),
+                                          ppvar_dpnd_dx,
+                                          ip,
+                                          scat_data,
+                                          ppath.los(ip, joker),
+                                          ppvar_t[Range(ip, 1)],
+                                          atmosphere_dim,
+                                          trans_in_jacobian && jacobian_do);
+
+          if (abs(pext_scaling - 1) > 1e-6) {
+            Kp *= pext_scaling;
+            if (trans_in_jacobian && j_analytical_do) {
+              FOR_ANALYTICAL_JACOBIANS_DO(dKp_dx[iq] *= pext_scaling;)
+            }
           }
-        }
 
-        // Some iy_aux quantities
-        if (auxAbSpAtte >= 0) {
-          for (Index iv = 0; iv < nf; iv++) {
-            iy_aux[auxAbSpAtte](iv*np+ip, joker) = K_this.Kjj()[iv];
+          // Some iy_aux quantities
+          if (auxAbSpAtte >= 0) {
+            for (Index iv = 0; iv < nf; iv++) {
+              iy_aux[auxAbSpAtte](iv*np+ip, joker) = K[ip].Kjj()[iv];
+            }
           }
-        }
-        if (auxPartAtte >= 0) {
-          for (Index iv = 0; iv < nf; iv++) {
-            iy_aux[auxPartAtte](iv*np+ip, joker) = Kp.Kjj()[iv];
+          if (auxPartAtte >= 0) {
+            for (Index iv = 0; iv < nf; iv++) {
+              iy_aux[auxPartAtte](iv*np+ip, joker) = Kp.Kjj()[iv];
+            }
           }
-        }
         
-        K_this += Kp;
-
-        if (trans_in_jacobian && j_analytical_do)
-          FOR_ANALYTICAL_JACOBIANS_DO(dK_this_dx[iq] += dKp_dx[iq];);
+          K[ip] += Kp;
+
+          if (trans_in_jacobian && j_analytical_do)
+            FOR_ANALYTICAL_JACOBIANS_DO(dK_dx[ip][iq] += dKp_dx[iq];);
+
+          // Get back-scattering per particle, where relevant
+          {
+            Tensor6 pha_mat_1se(nf_ssd, 1, 1, 1, ns, ns);
+            Vector t_ok(1);
+            Matrix mlos_sca(1, 2), mlos_inc(1, 2);
+            Index ptype;
+
+            // Direction of outgoing scattered radiation (which is reverse to LOS).
+            Vector los_sca;
+            mirror_los(los_sca, ppath.los(ip, joker), atmosphere_dim);
+            mlos_sca(0, joker) = los_sca;
+
+            // Obtain a length-2 vector for incoming direction
+            Vector los_inc;
+            if (atmosphere_dim == 3) {
+              los_inc = ppath.los(ip, joker);
+            } else { // Mirror back to get a correct 3D LOS
+              mirror_los(los_inc, los_sca, 3);
+            }
+            mlos_inc(0, joker) = los_inc;
+
+            Index i_se_flat = 0;
+            for (Index i_ss = 0; i_ss < scat_data.nelem(); i_ss++)
+              for (Index i_se = 0; i_se < scat_data[i_ss].nelem(); i_se++) {
+                // determine whether we have some valid pnd for this
+                // scatelem (in pnd or dpnd)
+                Index val_pnd = 0;
+                if (ppvar_pnd(i_se_flat, ip) != 0)
+                  val_pnd = 1;
+                else if (j_analytical_do)
+                  for (Index iq = 0; iq < nq && !val_pnd; iq++)
+                    if (jac_scat_i[iq] >= 0)
+                      if (ppvar_dpnd_dx[iq](i_se_flat, ip) != 0) {
+                        val_pnd = 1;
+                        break;
+                      }
+                if (val_pnd) {
+                  pha_mat_1ScatElem(pha_mat_1se,
+                                    ptype,
+                                    t_ok,
+                                    scat_data[i_ss][i_se],
+                                    Vector{ppvar_t[Range(ip, 1)]},
+                                    mlos_sca,
+                                    mlos_inc,
+                                    0,
+                                    t_interp_order);
+                  if (t_ok[0] not_eq 0)
+                    if (duplicate_freqs)
+                      for (Index iv = 0; iv < nf; iv++)
+                        Pe(i_se_flat, ip, iv, joker, joker) =
+                            pha_mat_1se(0, 0, 0, 0, joker, joker);
+                    else
+                      Pe(i_se_flat, ip, joker, joker, joker) =
+                          pha_mat_1se(joker, 0, 0, 0, joker, joker);
+                  else {
+                    ARTS_USER_ERROR (
+                      "Interpolation error for (flat-array) scattering"
+                      " element #", i_se_flat, "\n"
+                      "at location/temperature point #", ip, "\n")
+                  }
+                }
+                i_se_flat++;
+              } // for i_ss
 
-        // Get back-scattering per particle, where relevant
+          }  // local scope
+        }    // clear2cloudy
+      } catch (const std::runtime_error& e) {
+        ostringstream os;
+        os << "Runtime-error in propagation matrix calculation at index "
+           << ip << ": \n";
+        os << e.what();
+#pragma omp critical(iyRadarSingleScat_propmat)
         {
-          // Direction of outgoing scattered radiation (which is reverse to LOS).
-          Vector los_sca;
-          mirror_los(los_sca, ppath.los(ip, joker), atmosphere_dim);
-          mlos_sca(0, joker) = los_sca;
-
-          // Obtain a length-2 vector for incoming direction
-          Vector los_inc;
-          if (atmosphere_dim == 3) {
-            los_inc = ppath.los(ip, joker);
-          } else { // Mirror back to get a correct 3D LOS
-            mirror_los(los_inc, los_sca, 3);
-          }
-          mlos_inc(0, joker) = los_inc;
-
-          Index i_se_flat = 0;
-          for (Index i_ss = 0; i_ss < scat_data.nelem(); i_ss++)
-            for (Index i_se = 0; i_se < scat_data[i_ss].nelem(); i_se++) {
-              // determine whether we have some valid pnd for this
-              // scatelem (in pnd or dpnd)
-              Index val_pnd = 0;
-              if (ppvar_pnd(i_se_flat, ip) != 0)
-                val_pnd = 1;
-              else if (j_analytical_do)
-                for (Index iq = 0; iq < nq && !val_pnd; iq++)
-                  if (jac_scat_i[iq] >= 0)
-                    if (ppvar_dpnd_dx[iq](i_se_flat, ip) != 0) {
-                      val_pnd = 1;
-                      break;
-                    }
-              if (val_pnd) {
-                pha_mat_1ScatElem(pha_mat_1se,
-                                  ptype,
-                                  t_ok,
-                                  scat_data[i_ss][i_se],
-                                  Vector{ppvar_t[Range(ip, 1)]},
-                                  mlos_sca,
-                                  mlos_inc,
-                                  0,
-                                  t_interp_order);
-                if (t_ok[0] not_eq 0)
-                  if (duplicate_freqs)
-                    for (Index iv = 0; iv < nf; iv++)
-                      Pe(i_se_flat, ip, iv, joker, joker) =
-                          pha_mat_1se(0, 0, 0, 0, joker, joker);
-                  else
-                    Pe(i_se_flat, ip, joker, joker, joker) =
-                        pha_mat_1se(joker, 0, 0, 0, joker, joker);
-                else {
-                  ARTS_USER_ERROR (
-                    "Interpolation error for (flat-array) scattering"
-                    " element #", i_se_flat, "\n"
-                    "at location/temperature point #", ip, "\n")
-                }
-              }
-              i_se_flat++;
-            } // for i_ss
+          do_abort = true;
+          fail_msg.push_back(os.str());
+        }
+      }
+    }
 
-        }  // local scope
-      }    // clear2cloudy
+    ARTS_USER_ERROR_IF (do_abort,
+      "Error messages from failed cases:\n", fail_msg)
 
-      if (ip not_eq 0) {
+#pragma omp parallel for if (!arts_omp_in_parallel())
+    for (Index ip = 1; ip < np; ip++) {
+      if (do_abort) continue;
+      try {
         const Numeric dr_dT_past =
             do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip - 1]) : 0;
         const Numeric dr_dT_this =
@@ -436,19 +466,29 @@ void iyRadarSingleScat(Workspace& ws,
         stepwise_transmission(lyr_tra[ip],
                               dlyr_tra_above[ip],
                               dlyr_tra_below[ip],
-                              K_past,
-                              K_this,
-                              dK_past_dx,
-                              dK_this_dx,
+                              K[ip - 1],
+                              K[ip],
+                              dK_dx[ip - 1],
+                              dK_dx[ip],
                               ppath.lstep[ip - 1],
                               dr_dT_past,
                               dr_dT_this,
                               temperature_derivative_position);
+      } catch (const std::runtime_error& e) {
+        ostringstream os;
+        os << "Runtime-error in transmission calculation at index " << ip
+           << ": \n";
+        os << e.what();
+#pragma omp critical(iyRadarSingleScat_transmission)
+        {
+          do_abort = true;
+          fail_msg.push_back(os.str());
+        }
       }
-
-      swap(K_past, K_this);
-      swap(dK_past_dx, dK_this_dx);
     }
+
+    ARTS_USER_ERROR_IF (do_abort,
+      "Error messages from failed cases:\n", fail_msg)
   }
 
   const ArrayOfTransmissionMatrix tot_tra_forward =
@@ -929,9 +969,10 @@ void particle_bulkpropRadarOnionPeeling(
 
   WorkspaceOmpParallelCopyGuard wss{ws};
   
-  // Loop all profiles
+  // Loop all profiles. Profiles without any significant reflectivity are
+  // cheap, so the work is distributed dynamically
 #pragma omp parallel for if (!arts_omp_in_parallel() && nlat + nlon > 2) \
-    firstprivate(wss) collapse(2)
+    firstprivate(wss) collapse(2) schedule(dynamic)
   for (Index ilat = 0; ilat < nlat; ilat++) {
     for (Index ilon = 0; ilon < nlon; ilon++) {
       if (fail_msg.nelem() != 0) continue;
@@ -1196,48 +1237,69 @@ void RadarOnionPeelingTableCalc(
   
   // Calculate dBZe and extinction for wc_grid
   //
-  Tensor3 D(2, nwc, nt, 0);
-  //
-  const Vector& pnd_agenda_input_t = t_grid;
-  Matrix pnd_agenda_input(nt, 1);
+  // The PSD is obtained for all combinations of water content and
+  // temperature by a single call of the agenda, where row w*nt+t of the
+  // input holds water content w and temperature t.
+  Vector pnd_agenda_input_t(nwc * nt);
+  Matrix pnd_agenda_input(nwc * nt, 1);
+  for (Index w=0; w<nwc; w++) {
+    for (Index t=0; t<nt; t++) {
+      pnd_agenda_input_t[w * nt + t] = t_grid[t];
+      pnd_agenda_input(w * nt + t, 0) = wc_grid[w];
+    }
+  }
   ArrayOfString dpnd_data_dx_names(0);
-  //
-  Vector cfac(1);
-  ze_cfac(cfac, f_grid, ze_tref, k2);
-  //
+  Matrix pnd_data;
+  Tensor3 dpnd_data_dx;
+  pnd_agenda_arrayExecute(ws,
+                          pnd_data,
+                          dpnd_data_dx,
+                          iss,
+                          pnd_agenda_input_t,
+                          pnd_agenda_input,
+                          pnd_agenda_array_input_names[iss],
+                          dpnd_data_dx_names,
+                          pnd_agenda_array);
+
+  for (Index t=0; t<nt; t++) {
+    for (Index i=0; i<nse; i++) {
+      ARTS_USER_ERROR_IF (b(t,i) < 0,
+        "A negative back-scattering found for scat_species ", iss,
+        ",\ntemperature ", t_grid[t], "K and element ", i)
+      ARTS_USER_ERROR_IF (e(t,i) < 0,
+        "A negative extinction found for scat_species ", iss,
+        ",\ntemperature ", t_grid[t], "K and element ", i)
+    }
+  }
   for (Index w=0; w<nwc; w++) {
-    // Get pnd
-    pnd_agenda_input = wc_grid[w];
-    Matrix pnd_data;
-    Tensor3 dpnd_data_dx;    
-    pnd_agenda_arrayExecute(ws,
-                            pnd_data,
-                            dpnd_data_dx,
-                            iss,
-                            pnd_agenda_input_t,
-                            pnd_agenda_input,
-                            pnd_agenda_array_input_names[iss],
-                            dpnd_data_dx_names,
-                            pnd_agenda_array);
-    
-    // Sum up to get bulk back-scattering and extinction
     for (Index t=0; t<nt; t++) {
       for (Index i=0; i<nse; i++) {
-        ARTS_USER_ERROR_IF (b(t,i) < 0,
-          "A negative back-scattering found for scat_species ", iss,
-          ",\ntemperature ", t_grid[t], "K and element ", i)
-        ARTS_USER_ERROR_IF (e(t,i) < 0,
-          "A negative extinction found for scat_species ", iss, 
-          ",\ntemperature ", t_grid[t], "K and element ", i)
-        ARTS_USER_ERROR_IF (pnd_data(t,i) < 0,
-          "A negative PSD value found for scat_species ", iss, 
+        ARTS_USER_ERROR_IF (pnd_data(w * nt + t, i) < 0,
+          "A negative PSD value found for scat_species ", iss,
           ",\ntemperature ", t_grid[t], "K and ", wc_grid[w],
           " kg/m3")
-        D(0,w,t) += pnd_data(t,i) * b(t,i);
-        D(1,w,t) += pnd_data(t,i) * e(t,i);
       }
+    }
+  }
+
+  // Sum up to get bulk back-scattering and extinction. For each
+  // temperature, this is a product between the PSDs of all water contents
+  // and the optical properties of all sizes.
+  Tensor3 D(2, nwc, nt, 0);
+  //
+  Vector cfac(1);
+  ze_cfac(cfac, f_grid, ze_tref, k2);
+  //
+#pragma omp parallel for if (!arts_omp_in_parallel() && nt > 1)
+  for (Index t=0; t<nt; t++) {
+    Matrix be(nse, 2), bulk(nwc, 2);
+    be(joker, 0) = b(t, joker);
+    be(joker, 1) = e(t, joker);
+    mult(bulk, pnd_data(Range(t, nwc, nt), joker), be);
+    for (Index w=0; w<nwc; w++) {
       // Convert to dBZe
-      D(0,w,t) = 10 * log10(cfac[0] * D(0,w,t));      
+      D(0,w,t) = 10 * log10(cfac[0] * bulk(w, 0));
+      D(1,w,t) = bulk(w, 1);
     }
   }
 
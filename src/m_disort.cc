@@ -66,6 +66,7 @@ void cloudbox_fieldDisort(Workspace& ws,
                     const Index& cdisort_quiet,
                     const Index& emission,
                     const Index& intensity_correction,
+                    const Numeric& layer_cache_tolerance,
                     const Verbosity& verbosity) {
   // Don't do anything if there's no cloudbox defined.
   if (!cloudbox_on) {
@@ -220,6 +221,7 @@ void cloudbox_fieldDisort(Workspace& ws,
               cdisort_quiet,
               emission,
               intensity_correction,
+              layer_cache_tolerance,
               verbosity);
 }
 
@@ -265,6 +267,7 @@ void cloudbox_fieldDisortWithARTSSurface(Workspace& ws,
                     const Index& emission,
                     const Index& intensity_correction,
                     const Numeric& inc_angle,
+                    const Numeric& layer_cache_tolerance,
                     const Verbosity& verbosity) {
 
   // Don't do anything if there's no cloudbox defined.
@@ -437,6 +440,7 @@ void cloudbox_fieldDisortWithARTSSurface(Workspace& ws,
               cdisort_quiet,
               emission,
               intensity_correction,
+              layer_cache_tolerance,
               verbosity);
 }
 
@@ -552,10 +556,90 @@ void spectral_radiance_fieldDisortClearsky(Workspace& ws,
                  0,
                  emission,
                  intensity_correction,
+                 -1,
                  verbosity);
 
 }
 
+/** Local direction and irradiance scaling of the sun at cloudbox top
+ *
+ * Common part of the irradiance methods for a 1D atmosphere at
+ * (lat_true, lon_true). If the sun is below the horizon, sun_on is set
+ * to 0.
+ *
+ * @param[out] sun_rte_los Line-of-sight to the sun at cloudbox top.
+ * @param[in,out] sun_on Flag for including the sun.
+ * @param[out] scale_factor Geometric factor scaling the spectral irradiance
+ *                at the surface of the sun to the one at cloudbox top.
+ * @param[in] suns The suns, only the first one is considered.
+ * @param[in] z_top Altitude of cloudbox top.
+ * @param[in] lat_true Latitude of the 1D atmosphere.
+ * @param[in] lon_true Longitude of the 1D atmosphere.
+ * @param[in] refellipsoid Reference ellipsoid.
+ * @param[in] verbosity Verbosity setting.
+ */
+static void sun_at_cloudbox_top(Vector& sun_rte_los,
+                                Index& sun_on,
+                                Numeric& scale_factor,
+                                const ArrayOfSun& suns,
+                                const Numeric& z_top,
+                                const Vector& lat_true,
+                                const Vector& lon_true,
+                                const Vector& refellipsoid,
+                                const Verbosity& verbosity) {
+  Vector lon_grid{lon_true[0] - 0.1, lon_true[0] + 0.1};
+  Vector lat_grid{lat_true[0] - 0.1, lat_true[0] + 0.1};
+
+  //Position of sun
+  const Vector sun_pos{suns[0].distance, suns[0].latitude, suns[0].longitude};
+
+  // Position of top of cloudbox
+  const Vector cloudboxtop_pos{z_top, lat_true[0], lon_true[0]};
+
+  // calculate local position of sun at top of cloudbox
+  rte_losGeometricFromRtePosToRtePos2(sun_rte_los,
+                                      3,
+                                      lat_grid,
+                                      lon_grid,
+                                      refellipsoid,
+                                      cloudboxtop_pos,
+                                      sun_pos,
+                                      verbosity);
+
+  //FIXME: IF we want to be correct and include refraction, we must calculate the
+  // local position of sun via ppathFromRtePos2. The question is, is this needed,
+  // because DISORT does not handle refraction at all.
+
+  // Check if sun is above horizon, if not switch it off
+  if (sun_rte_los[0] >= 90) {
+    sun_on = 0;
+
+    CREATE_OUT0;
+    out0 << "Sun is below the horizon\n";
+    out0 << "Sun is ignored.\n";
+  }
+
+  //get the cloudbox top distance to earth center.
+  Numeric R_TOA = refell2r(refellipsoid,
+                           lat_true[0]) +
+                  cloudboxtop_pos[0];
+
+  //get the distance between sun and cloudbox top
+  Numeric R_Sun2CloudboxTop;
+  distance3D(R_Sun2CloudboxTop,
+             R_TOA,
+             lat_true[0],
+             lon_true[0],
+             sun_pos[0],
+             sun_pos[1],
+             sun_pos[2]);
+
+  // Geometric scaling factor, scales the sun spectral irradiance at the surface
+  // of the sun to the spectral irradiance of the sun at cloubbox top.
+  scale_factor=suns[0].radius*suns[0].radius/
+                 (suns[0].radius*suns[0].radius+R_Sun2CloudboxTop*R_Sun2CloudboxTop);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void spectral_irradiance_fieldDisort(Workspace& ws,
                 // WS Output:
@@ -624,72 +708,23 @@ void spectral_irradiance_fieldDisort(Workspace& ws,
                      " suns. \n"
                      "Disort can handle only one sun.")
 
-  //allocate Varibale for direct (sun) source
-  Vector sun_rte_los;
-  Vector sun_pos(3);
-  Vector cloudboxtop_pos(3);
-  Index sun_on = suns_do;
-  Numeric scale_factor;
-
   spectral_irradiance_field.resize(Nf, Np_cloud, 1, 1, 2);
   spectral_irradiance_field = NAN;
 
-  if (sun_on){
-
-    Vector lon_grid{lon_true[0] - 0.1, lon_true[0] + 0.1};
-    Vector lat_grid{lat_true[0] - 0.1, lat_true[0] + 0.1};
-
-    //Position of sun
-    sun_pos = {suns[0].distance, suns[0].latitude, suns[0].longitude};
-
-    // Position of top of cloudbox
-    cloudboxtop_pos = {
-        z_field(cloudbox_limits[1], 0, 0), lat_true[0], lon_true[0]};
-
-    // calculate local position of sun at top of cloudbox
-    rte_losGeometricFromRtePosToRtePos2(sun_rte_los,
-                                        3,
-                                        lat_grid,
-                                        lon_grid,
-                                        refellipsoid,
-                                        cloudboxtop_pos,
-                                        sun_pos,
-                                        verbosity);
-
-    //FIXME: IF we want to be correct and include refraction, we must calculate the
-    // local position of sun via ppathFromRtePos2. The question is, is this needed,
-    // because DISORT does not handle refraction at all.
-
-    // Check if sun is above horizon, if not switch it off
-    if (sun_rte_los[0] >= 90) {
-      sun_on = 0;
-
-      CREATE_OUT0;
-      out0 << "Sun is below the horizon\n";
-      out0 << "Sun is ignored.\n";
-    }
-
-    //get the cloudbox top distance to earth center.
-    Numeric R_TOA = refell2r(refellipsoid,
-                             lat_true[0]) +
-                    cloudboxtop_pos[0];
-
-    //get the distance between sun and cloudbox top
-    Numeric R_Sun2CloudboxTop;
-    distance3D(R_Sun2CloudboxTop,
-               R_TOA,
-               lat_true[0],
-               lon_true[0],
-               sun_pos[0],
-               sun_pos[1],
-               sun_pos[2]);
-
-    // Geometric scaling factor, scales the sun spectral irradiance at the surface
-    // of the sun to the spectral irradiance of the sun at cloubbox top.
-    scale_factor=suns[0].radius*suns[0].radius/
-                   (suns[0].radius*suns[0].radius+R_Sun2CloudboxTop*R_Sun2CloudboxTop);
-
-  }
+  // Local position of the sun and its spectral irradiance at cloudbox top
+  Vector sun_rte_los;
+  Index sun_on = suns_do;
+  Numeric scale_factor = 0;
+  if (sun_on)
+    sun_at_cloudbox_top(sun_rte_los,
+                        sun_on,
+                        scale_factor,
+                        suns,
+                        z_field(cloudbox_limits[1], 0, 0),
+                        lat_true,
+                        lon_true,
+                        refellipsoid,
+                        verbosity);
 
   Vector albedo(f_grid.nelem(), 0.);
   Numeric btemp;
@@ -726,4 +761,114 @@ void spectral_irradiance_fieldDisort(Workspace& ws,
                    emission,
                    intensity_correction,
                    verbosity);
-}
\ No newline at end of file
+}
+/* Workspace method: Doxygen documentation will be auto-generated */
+void spectral_irradiance_fieldTwoStream(Workspace& ws,
+                // WS Output:
+                Tensor5& spectral_irradiance_field,
+                // WS Input
+                const Index& atmfields_checked,
+                const Index& atmgeom_checked,
+                const Index& scat_data_checked,
+                const Agenda& propmat_clearsky_agenda,
+                const Agenda& gas_scattering_agenda,
+                const Index& atmosphere_dim,
+                const Tensor4& pnd_field,
+                const Tensor3& t_field,
+                const Tensor3& z_field,
+                const Tensor4& vmr_field,
+                const Vector& p_grid,
+                const Vector& lat_true,
+                const Vector& lon_true,
+                const Vector& refellipsoid,
+                const ArrayOfArrayOfSingleScatteringData& scat_data,
+                const ArrayOfSun& suns,
+                const Vector& f_grid,
+                const Index& stokes_dim,
+                const Matrix& z_surface,
+                const Numeric& surface_skin_t,
+                const Vector& surface_scalar_reflectivity,
+                const Index& gas_scattering_do,
+                const Index& suns_do,
+                const Index& Npfct,
+                const Index& emission,
+                const Verbosity& verbosity) {
+
+  // Set cloudbox to cover complete atmosphere
+  Index cloudbox_on;
+  ArrayOfIndex cloudbox_limits;
+  cloudboxSetFullAtm(cloudbox_on,
+                     cloudbox_limits,
+                     atmosphere_dim,
+                     p_grid,
+                     Vector(0),
+                     Vector(0),
+                     0.,
+                     verbosity);
+
+  const Index Nf = f_grid.nelem();
+  const Index Np_cloud = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+
+  // Same requirements as for DISORT, two streams
+  check_disort_irradiance_input(atmfields_checked,
+                                atmgeom_checked,
+                                scat_data_checked,
+                                atmosphere_dim,
+                                stokes_dim,
+                                scat_data,
+                                2);
+
+  //Check for number of suns
+  ARTS_USER_ERROR_IF(suns.nelem() > 1,
+                     "The simulation setup contains ",
+                     suns.nelem(),
+                     " suns. \n"
+                     "The two-stream solver can handle only one sun.")
+
+  spectral_irradiance_field.resize(Nf, Np_cloud, 1, 1, 2);
+  spectral_irradiance_field = NAN;
+
+  // Local position of the sun and its spectral irradiance at cloudbox top
+  Vector sun_rte_los;
+  Index sun_on = suns_do;
+  Numeric scale_factor = 0;
+  if (sun_on)
+    sun_at_cloudbox_top(sun_rte_los,
+                        sun_on,
+                        scale_factor,
+                        suns,
+                        z_field(cloudbox_limits[1], 0, 0),
+                        lat_true,
+                        lon_true,
+                        refellipsoid,
+                        verbosity);
+
+  Vector albedo(f_grid.nelem(), 0.);
+  Numeric btemp;
+
+  get_disortsurf_props(
+      albedo, btemp, f_grid, surface_skin_t, surface_scalar_reflectivity);
+
+  run_two_stream_flux(ws,
+                      spectral_irradiance_field,
+                      f_grid,
+                      p_grid,
+                      z_field(joker, 0, 0),
+                      z_surface(0, 0),
+                      t_field(joker, 0, 0),
+                      vmr_field(joker, joker, 0, 0),
+                      pnd_field(joker, joker, 0, 0),
+                      scat_data,
+                      suns,
+                      propmat_clearsky_agenda,
+                      gas_scattering_agenda,
+                      cloudbox_limits,
+                      btemp,
+                      albedo,
+                      sun_rte_los,
+                      gas_scattering_do,
+                      sun_on,
+                      scale_factor,
+                      Npfct,
+                      emission);
+}
@@ -15,6 +15,7 @@
   === External declarations
   ===========================================================================*/
 
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -468,6 +469,7 @@ void cloudbox_field_monoIterate(Workspace& ws,
                                 const Agenda& doit_rte_agenda,
                                 const Agenda& doit_conv_test_agenda,
                                 const Index& accelerated,
+                                const Index& anderson_depth,
                                 const Verbosity& verbosity)
 
 {
@@ -475,6 +477,11 @@ void cloudbox_field_monoIterate(Workspace& ws,
 
   //---------------Check input---------------------------------
   chk_not_empty("doit_scat_field_agenda", doit_scat_field_agenda);
+  ARTS_USER_ERROR_IF(anderson_depth < 0,
+                     "*anderson_depth* must be >= 0.");
+  ARTS_USER_ERROR_IF(accelerated > 0 and anderson_depth > 0,
+                     "Ng (*accelerated*) and Anderson (*anderson_depth*)\n"
+                     "acceleration can not be combined.");
   chk_not_empty("doit_rte_agenda", doit_rte_agenda);
   chk_not_empty("doit_conv_test_agenda", doit_conv_test_agenda);
 
@@ -514,6 +521,11 @@ void cloudbox_field_monoIterate(Workspace& ws,
   if (accelerated) {
     acceleration_input.resize(4);
   }
+  // History of residuals and sweep outputs for Anderson acceleration
+  ArrayOfTensor6 anderson_f, anderson_g;
+
+  const auto time_start = std::chrono::steady_clock::now();
+
   while (doit_conv_flag_local == 0) {
     // 1. Copy cloudbox_field to cloudbox_field_old.
     cloudbox_field_mono_old_local = cloudbox_field_mono;
@@ -548,7 +560,22 @@ void cloudbox_field_monoIterate(Workspace& ws,
             cloudbox_field_mono, acceleration_input, accelerated, verbosity);
       }
     }
+
+    // Anderson acceleration, if wished.
+    if (anderson_depth > 0 && doit_conv_flag_local == 0) {
+      cloudbox_field_andersonAcceleration(cloudbox_field_mono,
+                                          anderson_f,
+                                          anderson_g,
+                                          cloudbox_field_mono_old_local,
+                                          anderson_depth,
+                                          verbosity);
+    }
   }  //end of while loop, convergence is reached.
+
+  const std::chrono::duration<Numeric> time_used =
+      std::chrono::steady_clock::now() - time_start;
+  out2 << "  DOIT converged after " << doit_iteration_counter_local
+       << " iterations (" << time_used.count() << " s).\n";
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -2041,7 +2068,6 @@ void doit_scat_fieldCalc(Workspace& ws,
 
 {
   CREATE_OUT2;
-  CREATE_OUT3;
 
   // ------------ Check the input -------------------------------
 
@@ -2149,26 +2175,27 @@ void doit_scat_fieldCalc(Workspace& ws,
 
   out2 << "  Calculate the scattered field\n";
 
+  const Index Np_cloud = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+
   if (atmosphere_dim == 1) {
     // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
+    // Since atmosphere_dim = 1, there is no loop over lat and lon grids.
+    // The phase matrices are taken from *pha_mat_doit*, i.e. they are
+    // calculated once and reused between the iterations. All pressure
+    // levels and zenith angles are independent.
+#pragma omp parallel for collapse(2) if (!arts_omp_in_parallel()) \
+    firstprivate(product_field)
+    for (Index p_index = 0; p_index < Np_cloud; p_index++) {
       //There is only loop over zenith angle grid ; no azimuth angle grid.
       for (Index za_index_local = 0; za_index_local < Nza; za_index_local++) {
-        // Calculate the phase matrix of individual scattering elements
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
         product_field = 0;
 
         // za_in and aa_in are for incoming zenith and azimuth
-        //angle direction for which pha_mat is calculated
+        //angle direction for which pha_mat is calculated.
         for (Index za_in = 0; za_in < Nza; ++za_in) {
           for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
             // Multiplication of phase matrix with incoming
             // intensity field.
-
             for (Index i = 0; i < stokes_dim; i++) {
               for (Index j = 0; j < stokes_dim; j++) {
                 product_field(za_in, aa_in, i) +=
@@ -2207,86 +2234,108 @@ void doit_scat_fieldCalc(Workspace& ws,
         when we calculate the pha_mat from pha_mat_spt and pnd_field
         using the method pha_matCalc.  */
 
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      for (Index lat_index = 0;
-           lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
-           lat_index++) {
-        for (Index lon_index = 0;
-             lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
-             lon_index++) {
-          Numeric rtp_temperature_local =
-              t_field(p_index + cloudbox_limits[0],
-                      lat_index + cloudbox_limits[2],
-                      lon_index + cloudbox_limits[4]);
-
-          for (Index aa_index_local = 1; aa_index_local < Naa;
-               aa_index_local++) {
-            for (Index za_index_local = 0; za_index_local < Nza;
-                 za_index_local++) {
-              out3 << "Calculate phase matrix \n";
-              pha_mat_spt_agendaExecute(ws,
-                                        pha_mat_spt_local,
-                                        za_index_local,
-                                        lat_index,
-                                        lon_index,
-                                        p_index,
-                                        aa_index_local,
-                                        rtp_temperature_local,
-                                        pha_mat_spt_agenda);
+    const Index Nlat_cloud = cloudbox_limits[3] - cloudbox_limits[2] + 1;
+    const Index Nlon_cloud = cloudbox_limits[5] - cloudbox_limits[4] + 1;
 
-              pha_matCalc(pha_mat_local,
-                          pha_mat_spt_local,
-                          pnd_field,
-                          atmosphere_dim,
-                          p_index,
-                          lat_index,
-                          lon_index,
-                          verbosity);
+    String fail_msg;
+    bool failed = false;
 
-              product_field = 0;
+    WorkspaceOmpParallelCopyGuard wss{ws};
 
-              //za_in and aa_in are the incoming directions
-              //for which pha_mat_spt is calculated
-              for (Index za_in = 0; za_in < Nza; ++za_in) {
-                for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-                  // Multiplication of phase matrix
-                  // with incloming intensity field.
-                  for (Index i = 0; i < stokes_dim; i++) {
-                    for (Index j = 0; j < stokes_dim; j++) {
-                      product_field(za_in, aa_in, i) +=
-                          pha_mat_local(za_in, aa_in, i, j) *
-                          cloudbox_field_mono(p_index,
-                                              lat_index,
-                                              lon_index,
-                                              za_index_local,
-                                              aa_index_local,
-                                              j);
+    // The grid points are independent and are distributed over the threads,
+    // each with its own workspace and phase matrix buffers
+#pragma omp parallel for collapse(3) if (!arts_omp_in_parallel()) \
+    firstprivate(wss, pha_mat_local, pha_mat_spt_local, product_field)
+    for (Index p_index = 0; p_index < Np_cloud; p_index++) {
+      for (Index lat_index = 0; lat_index < Nlat_cloud; lat_index++) {
+        for (Index lon_index = 0; lon_index < Nlon_cloud; lon_index++) {
+          if (failed) continue;
+          try {
+            Numeric rtp_temperature_local =
+                t_field(p_index + cloudbox_limits[0],
+                        lat_index + cloudbox_limits[2],
+                        lon_index + cloudbox_limits[4]);
+
+            for (Index aa_index_local = 1; aa_index_local < Naa;
+                 aa_index_local++) {
+              for (Index za_index_local = 0; za_index_local < Nza;
+                   za_index_local++) {
+                pha_mat_spt_agendaExecute(wss,
+                                          pha_mat_spt_local,
+                                          za_index_local,
+                                          lat_index,
+                                          lon_index,
+                                          p_index,
+                                          aa_index_local,
+                                          rtp_temperature_local,
+                                          pha_mat_spt_agenda);
+
+                pha_matCalc(pha_mat_local,
+                            pha_mat_spt_local,
+                            pnd_field,
+                            atmosphere_dim,
+                            p_index,
+                            lat_index,
+                            lon_index,
+                            verbosity);
+
+                product_field = 0;
+
+                //za_in and aa_in are the incoming directions
+                //for which pha_mat_spt is calculated
+                for (Index za_in = 0; za_in < Nza; ++za_in) {
+                  for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
+                    // Multiplication of phase matrix
+                    // with incloming intensity field.
+                    for (Index i = 0; i < stokes_dim; i++) {
+                      for (Index j = 0; j < stokes_dim; j++) {
+                        product_field(za_in, aa_in, i) +=
+                            pha_mat_local(za_in, aa_in, i, j) *
+                            cloudbox_field_mono(p_index,
+                                                lat_index,
+                                                lon_index,
+                                                za_index_local,
+                                                aa_index_local,
+                                                j);
+                      }
                     }
-                  }
-                }  //end aa_in loop
-              }    //end za_in loop
-              //integration of the product of ifield_in and pha
-              //over zenith angle and azimuth angle grid. It
-              //calls here the integration routine
-              //AngIntegrate_trapezoid_opti
-              for (Index i = 0; i < stokes_dim; i++) {
-                doit_scat_field(p_index,
-                                lat_index,
-                                lon_index,
-                                za_index_local,
-                                aa_index_local,
-                                i) =
-                    AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                                za_grid,
-                                                aa_grid,
-                                                grid_stepsize);
-              }  //end i loop
-            }    //end aa_prop loop
-          }      //end za_prop loop
-        }        //end lon loop
-      }          // end lat loop
-    }            // end p loop
+                  }  //end aa_in loop
+                }    //end za_in loop
+                //integration of the product of ifield_in and pha
+                //over zenith angle and azimuth angle grid. It
+                //calls here the integration routine
+                //AngIntegrate_trapezoid_opti
+                for (Index i = 0; i < stokes_dim; i++) {
+                  doit_scat_field(p_index,
+                                  lat_index,
+                                  lon_index,
+                                  za_index_local,
+                                  aa_index_local,
+                                  i) =
+                      AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
+                                                  za_grid,
+                                                  aa_grid,
+                                                  grid_stepsize);
+                }  //end i loop
+              }    //end aa_prop loop
+            }      //end za_prop loop
+          } catch (const std::exception& e) {
+            ostringstream os;
+            os << "Error for (p_index, lat_index, lon_index) = (" << p_index
+               << ", " << lat_index << ", " << lon_index << ")\n"
+               << e.what();
+#pragma omp critical(doit_scat_fieldCalc_fail)
+            {
+              failed = true;
+              fail_msg = os.str();
+            }
+          }
+        }  //end lon loop
+      }    // end lat loop
+    }      // end p loop
+
+    ARTS_USER_ERROR_IF(failed, fail_msg);
+
     // aa = 0 is the same as aa = 180:
     doit_scat_field(joker, joker, joker, joker, 0, joker) =
         doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
@@ -2450,9 +2499,12 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
 
   if (atmosphere_dim == 1) {
     // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
+    // Since atmosphere_dim = 1, there is no loop over lat and lon grids.
+    // The pressure levels are independent.
+    const Index Np_cloud = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+#pragma omp parallel for if (!arts_omp_in_parallel()) \
+    firstprivate(cloudbox_field_int, doit_scat_field_org, product_field)
+    for (Index p_index = 0; p_index < Np_cloud; p_index++) {
       // Interpolate intensity field:
       for (Index i = 0; i < stokes_dim; i++) {
         if (doit_za_interp == 0) {
@@ -2478,9 +2530,6 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
       //There is only loop over zenith angle grid; no azimuth angle grid.
       for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
            za_index_local++) {
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
         product_field = 0;
 
         // za_in and aa_in are for incoming zenith and azimuth
@@ -2502,7 +2551,6 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
           }  //end aa_in loop
         }    //end za_in loop
 
-        out3 << "Compute integral. \n";
         if (Naa == 1) {
           for (Index i = 0; i < stokes_dim; i++) {
             doit_scat_field_org(za_index_local, i) =
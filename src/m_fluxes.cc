@@ -1,8 +1,11 @@
 /*===========================================================================
   ===  File description
   ===========================================================================*/
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 #include "absorption.h"
 #include "agenda_class.h"
 #include "agenda_set.h"
@@ -10,6 +13,7 @@
 #include "arts_conversions.h"
 #include "auto_md.h"
 #include "check_input.h"
+#include "disort.h"
 #include "fluxes.h"
 #include "math_funcs.h"
 #include "matpack_data.h"
@@ -22,6 +26,8 @@
 #include "gsl_gauss_legendre.h"
 #include "geodetic.h"
 #include "physics_funcs.h"
+#include "rte.h"
+#include "transmissionmatrix.h"
 
 
 /*!
@@ -174,6 +180,143 @@ void AngularGridsSetFluxCalc(Vector& za_grid,
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void f_gridCorrelatedK(Workspace& ws,
+                       Vector& f_grid,
+                       Vector& f_grid_weights,
+                       const Index& atmosphere_dim,
+                       const Vector& p_grid,
+                       const Tensor3& z_field,
+                       const Tensor3& t_field,
+                       const Tensor4& vmr_field,
+                       const Agenda& propmat_clearsky_agenda,
+                       const Vector& f_grid_lbl,
+                       const Vector& band_edges,
+                       const Index& n_gpoints,
+                       const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  ARTS_USER_ERROR_IF(atmosphere_dim != 1,
+                     "This method only works for atmosphere_dim = 1.");
+  ARTS_USER_ERROR_IF(n_gpoints < 1, "*n_gpoints* must be > 0.");
+  ARTS_USER_ERROR_IF(band_edges.nelem() < 2,
+                     "*band_edges* must contain at least two values.");
+  ARTS_USER_ERROR_IF(f_grid_lbl.nelem() < 2,
+                     "*f_grid_lbl* must contain at least two values.");
+  chk_if_increasing("band_edges", band_edges);
+  chk_if_increasing("f_grid_lbl", f_grid_lbl);
+
+  const Index nl = p_grid.nelem();
+  const Index nf = f_grid_lbl.nelem();
+  const Index nb = band_edges.nelem() - 1;
+
+  // Gas extinction at all levels and the zenith optical depth of the column
+  Matrix ext_bulk_gas(nf, nl);
+  get_gasoptprop(ws,
+                 ext_bulk_gas,
+                 propmat_clearsky_agenda,
+                 t_field(joker, 0, 0),
+                 vmr_field(joker, joker, 0, 0),
+                 p_grid,
+                 f_grid_lbl);
+
+  Vector tau(nf, 0);
+  for (Index i = 0; i < nf; i++) {
+    for (Index l = 0; l < nl - 1; l++) {
+      tau[i] += 0.5 * (ext_bulk_gas(i, l) + ext_bulk_gas(i, l + 1)) *
+                abs(z_field(l + 1, 0, 0) - z_field(l, 0, 0));
+    }
+  }
+
+  // Trapezoidal weights of the monochromatic grid
+  Vector w_lbl(nf);
+  w_lbl[0] = 0.5 * (f_grid_lbl[1] - f_grid_lbl[0]);
+  w_lbl[nf - 1] = 0.5 * (f_grid_lbl[nf - 1] - f_grid_lbl[nf - 2]);
+  for (Index i = 1; i < nf - 1; i++) {
+    w_lbl[i] = 0.5 * (f_grid_lbl[i + 1] - f_grid_lbl[i - 1]);
+  }
+
+  std::vector<std::pair<Numeric, Numeric>> gpoints;
+  for (Index b = 0; b < nb; b++) {
+    ArrayOfIndex members;
+    for (Index i = 0; i < nf; i++) {
+      if (f_grid_lbl[i] >= band_edges[b] &&
+          (f_grid_lbl[i] < band_edges[b + 1] ||
+           (b == nb - 1 && f_grid_lbl[i] == band_edges[b + 1]))) {
+        members.push_back(i);
+      }
+    }
+    if (members.empty()) {
+      out2 << "  Band " << b << ": no frequencies of *f_grid_lbl*.\n";
+      continue;
+    }
+
+    // Nothing to gain, keep the monochromatic frequencies
+    if (members.nelem() <= n_gpoints) {
+      for (const Index i : members) {
+        gpoints.emplace_back(f_grid_lbl[i], w_lbl[i]);
+      }
+      out2 << "  Band " << b << ": " << members.nelem()
+           << " monochromatic frequencies kept.\n";
+      continue;
+    }
+
+    std::stable_sort(members.begin(), members.end(), [&](Index i, Index j) {
+      return tau[i] < tau[j];
+    });
+
+    Numeric w_band = 0;
+    for (const Index i : members) w_band += w_lbl[i];
+
+    // Assign each frequency to the g-interval holding the centre of its
+    // cumulative weight, and pick the weighted median of each interval
+    Index ng = 0;
+    Numeric g = 0;
+    auto m = members.cbegin();
+    for (Index k = 0; k < n_gpoints && m != members.cend(); k++) {
+      const Numeric g_upper = Numeric(k + 1) / Numeric(n_gpoints);
+      auto m_end = m;
+      Numeric w_g = 0;
+      while (m_end != members.cend() &&
+             (k == n_gpoints - 1 ||
+              g + (w_g + 0.5 * w_lbl[*m_end]) / w_band < g_upper)) {
+        w_g += w_lbl[*m_end];
+        ++m_end;
+      }
+      if (m_end == m) continue;
+
+      Numeric w_cum = 0;
+      auto rep = m;
+      for (auto it = m; it != m_end; ++it) {
+        w_cum += w_lbl[*it];
+        rep = it;
+        if (w_cum >= 0.5 * w_g) break;
+      }
+
+      gpoints.emplace_back(f_grid_lbl[*rep], w_g);
+      g += w_g / w_band;
+      m = m_end;
+      ng++;
+    }
+
+    out2 << "  Band " << b << ": " << members.nelem()
+         << " monochromatic frequencies represented by " << ng
+         << " g-points.\n";
+  }
+
+  ARTS_USER_ERROR_IF(gpoints.empty(),
+                     "No frequency of *f_grid_lbl* is inside the bands.");
+
+  std::sort(gpoints.begin(), gpoints.end());
+
+  f_grid.resize(gpoints.size());
+  f_grid_weights.resize(gpoints.size());
+  for (Index i = 0; i < f_grid.nelem(); i++) {
+    f_grid[i] = gpoints[i].first;
+    f_grid_weights[i] = gpoints[i].second;
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void heating_ratesFromIrradianceSimple(
     Tensor3& heating_rates,
@@ -335,12 +478,16 @@ void irradiance_fieldFromRadiance(Tensor4& irradiance_field,
 void RadiationFieldSpectralIntegrate(Tensor4& radiation_field,
                                      const Vector& f_grid,
                                      const Tensor5& spectral_radiation_field,
+                                     const Vector& f_grid_weights,
                                      const Verbosity&) {
   if (f_grid.nelem() != spectral_radiation_field.nshelves()) {
     throw runtime_error(
         "The length of f_grid does not match with\n"
         " the first dimension of the spectral_radiation_field");
   }
+  ARTS_USER_ERROR_IF(
+      f_grid_weights.nelem() && f_grid_weights.nelem() != f_grid.nelem(),
+      "The length of f_grid_weights does not match with f_grid");
 
   //allocate
   radiation_field.resize(spectral_radiation_field.nbooks(),
@@ -349,6 +496,16 @@ void RadiationFieldSpectralIntegrate(Tensor4& radiation_field,
                          spectral_radiation_field.ncols());
   radiation_field = 0;
 
+  // weighted sum, e.g. over g-points
+  if (f_grid_weights.nelem()) {
+    for (Index i = 0; i < spectral_radiation_field.nshelves(); i++) {
+      Tensor4 field_i{spectral_radiation_field(i, joker, joker, joker, joker)};
+      field_i *= f_grid_weights[i];
+      radiation_field += field_i;
+    }
+    return;
+  }
+
   // frequency integration
   for (Index i = 0; i < spectral_radiation_field.nshelves() - 1; i++) {
     const Numeric df = f_grid[i + 1] - f_grid[i];
@@ -372,12 +529,16 @@ void RadiationFieldSpectralIntegrate(Tensor4& radiation_field,
 void RadiationFieldSpectralIntegrate(Tensor5& radiation_field,
                                      const Vector& f_grid,
                                      const Tensor7& spectral_radiation_field,
+                                     const Vector& f_grid_weights,
                                      const Verbosity&) {
   if (f_grid.nelem() != spectral_radiation_field.nlibraries()) {
     throw runtime_error(
         "The length of f_grid does not match with\n"
         " the first dimension of the spectral_radiation_field");
   }
+  ARTS_USER_ERROR_IF(
+      f_grid_weights.nelem() && f_grid_weights.nelem() != f_grid.nelem(),
+      "The length of f_grid_weights does not match with f_grid");
 
   //allocate
   radiation_field.resize(spectral_radiation_field.nvitrines(),
@@ -387,6 +548,17 @@ void RadiationFieldSpectralIntegrate(Tensor5& radiation_field,
                          spectral_radiation_field.nrows());
   radiation_field = 0;
 
+  // weighted sum, e.g. over g-points
+  if (f_grid_weights.nelem()) {
+    for (Index i = 0; i < spectral_radiation_field.nlibraries(); i++) {
+      Tensor5 field_i{
+          spectral_radiation_field(i, joker, joker, joker, joker, joker, 0)};
+      field_i *= f_grid_weights[i];
+      radiation_field += field_i;
+    }
+    return;
+  }
+
   // frequency integration
   for (Index i = 0; i < spectral_radiation_field.nlibraries() - 1; i++) {
     const Numeric df = f_grid[i + 1] - f_grid[i];
@@ -518,10 +690,25 @@ void spectral_radiance_fieldClearskyPlaneParallel(
     const Tensor3& surface_props_data,
     const Vector& za_grid,
     const Index& use_parallel_za  [[maybe_unused]],
+    const Index& share_propmat,
     const Verbosity& verbosity) {
   // Check input
   if (atmosphere_dim != 1)
     throw runtime_error("This method only works for atmosphere_dim = 1.");
+  if (share_propmat) {
+    auto nonzero = [](const Tensor3& x) {
+      if (x.empty()) return false;
+      const auto [xmin, xmax] = minmax(x);
+      return xmin != 0 || xmax != 0;
+    };
+    ARTS_USER_ERROR_IF(
+        rte_alonglos_v != 0 || nonzero(wind_u_field) ||
+            nonzero(wind_v_field) || nonzero(wind_w_field) ||
+            nonzero(mag_u_field) || nonzero(mag_v_field) ||
+            nonzero(mag_w_field),
+        "With *share_propmat*, absorption must not depend on direction.\n"
+        "That is, winds, magnetic field and *rte_alonglos_v* must be zero.")
+  }
 
   // Sizes
   const Index nl = p_grid.nelem();
@@ -558,6 +745,119 @@ void spectral_radiance_fieldClearskyPlaneParallel(
   // Index in p_grid where field at surface shall be placed
   const Index i0 = index_of_zsurface(z_surface(0, 0), z_field(joker, 0, 0));
 
+  // Propagation matrix and source at the points of a vertical path, from
+  // TOA down to the surface. In a plane-parallel atmosphere only the path
+  // length differs between the zenith angles, so these are calculated once
+  // and shared by all angles.
+  Ppath ppath_vert;
+  ArrayOfPropagationMatrix K_vert;
+  ArrayOfRadiationVector src_vert;
+  if (nza && share_propmat) {
+    ppathPlaneParallel(ppath_vert,
+                       atmosphere_dim,
+                       z_field,
+                       z_surface,
+                       cloudbox_on,
+                       cloudbox_limits,
+                       ppath_inside_cloudbox_do,
+                       Vector(1, z_space),
+                       Vector(1, 180),
+                       -1,
+                       verbosity);
+    const Index np = ppath_vert.np;
+
+    Vector ppvar_p, ppvar_t;
+    Matrix ppvar_vmr, ppvar_wind, ppvar_mag;
+    EnergyLevelMap ppvar_nlte;
+    get_ppath_atmvars(ppvar_p,
+                      ppvar_t,
+                      ppvar_nlte,
+                      ppvar_vmr,
+                      ppvar_wind,
+                      ppvar_mag,
+                      ppath_vert,
+                      atmosphere_dim,
+                      p_grid,
+                      t_field,
+                      nlte_field,
+                      vmr_field,
+                      wind_u_field,
+                      wind_v_field,
+                      wind_w_field,
+                      mag_u_field,
+                      mag_v_field,
+                      mag_w_field);
+
+    K_vert.resize(np, PropagationMatrix(nf, stokes_dim));
+    src_vert.resize(np, RadiationVector(nf, stokes_dim));
+
+    Vector B(nf), dB_dT(0);
+    StokesVector a(nf, stokes_dim), S(nf, stokes_dim);
+    ArrayOfPropagationMatrix dK_dx;
+    ArrayOfStokesVector da_dx, dS_dx;
+    ArrayOfRadiationVector dsrc;
+
+    WorkspaceOmpParallelCopyGuard wss{ws};
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && np > 1) \
+    firstprivate(wss, B, dB_dT, a, S, dK_dx, da_dx, dS_dx, dsrc)
+    for (Index ip = 0; ip < np; ip++) {
+      if (failed) continue;
+      try {
+        get_stepwise_blackbody_radiation(B, dB_dT, f_grid, ppvar_t[ip], false);
+
+        Index lte;
+        get_stepwise_clearsky_propmat(wss,
+                                      K_vert[ip],
+                                      S,
+                                      lte,
+                                      dK_dx,
+                                      dS_dx,
+                                      propmat_clearsky_agenda,
+                                      jacobian_quantities,
+                                      f_grid,
+                                      Vector{ppvar_mag(joker, ip)},
+                                      Vector{ppath_vert.los(ip, joker)},
+                                      ppvar_nlte[ip],
+                                      Vector{ppvar_vmr(joker, ip)},
+                                      ppvar_t[ip],
+                                      ppvar_p[ip],
+                                      false);
+
+        // Here absorption equals extinction
+        a = K_vert[ip];
+        RadiationVector scattered_sunlight(nf, stokes_dim);
+        stepwise_source(src_vert[ip],
+                        dsrc,
+                        scattered_sunlight,
+                        K_vert[ip],
+                        a,
+                        S,
+                        dK_dx,
+                        da_dx,
+                        dS_dx,
+                        B,
+                        dB_dT,
+                        jacobian_quantities,
+                        false);
+      } catch (const std::exception& e) {
+        ostringstream os;
+        os << "Run-time error at level #" << ip << ": \n" << e.what();
+#pragma omp critical(planep_push_fail_msg)
+        {
+          failed = true;
+          fail_msg.push_back(os.str());
+        }
+      }
+    }
+
+    if (fail_msg.nelem()) {
+      ostringstream os;
+      for (auto& msg : fail_msg) os << msg << '\n';
+      throw runtime_error(os.str());
+    }
+  }
+
   // Loop zenith angles
   //
   if (nza) {
@@ -591,60 +891,180 @@ void spectral_radiance_fieldClearskyPlaneParallel(
                            ppath_inside_cloudbox_do,
                            rte_pos,
                            rte_los,
-                           ppath_lmax,
+                           share_propmat ? -1 : ppath_lmax,
                            verbosity);
         ARTS_ASSERT(ppath.gp_p[ppath.np - 1].idx == i0 ||
                ppath.gp_p[ppath.np - 1].idx == nl - 2);
 
-        iyEmissionStandard(wss,
-                           iy,
-                           iy_aux,
-                           diy_dx,
-                           ppvar_p,
-                           ppvar_t,
-                           ppvar_nlte,
-                           ppvar_vmr,
-                           ppvar_wind,
-                           ppvar_mag,
-                           ppvar_f,
-                           ppvar_iy,
-                           ppvar_trans_cumulat,
-                           ppvar_trans_partial,
-                           iy_id,
-                           stokes_dim,
-                           f_grid,
-                           atmosphere_dim,
-                           p_grid,
-                           t_field,
-                           nlte_field,
-                           vmr_field,
-                           abs_species,
-                           wind_u_field,
-                           wind_v_field,
-                           wind_w_field,
-                           mag_u_field,
-                           mag_v_field,
-                           mag_w_field,
-                           cloudbox_on,
-                           iy_unit,
-                           iy_aux_vars,
-                           jacobian_do,
-                           jacobian_quantities,
-                           ppath,
-                           rte_pos2,
-                           propmat_clearsky_agenda,
-                           water_p_eq_agenda,
-                           rt_integration_option,
-                           iy_main_agenda,
-                           iy_space_agenda,
-                           iy_surface_agenda,
-                           iy_cloudbox_agenda,
-                           iy_agenda_call1,
-                           iy_transmittance,
-                           rte_alonglos_v,
-                           surface_props_data,
-                           verbosity);
-        ARTS_ASSERT(iy.ncols() == stokes_dim);
+        // The shared properties are only used when the path passes the same
+        // levels as the vertical path. This is not the case for e.g. a
+        // horizontal path at TOA, calculated as without sharing.
+        if (share_propmat && ppath.np == ppath_vert.np) {
+          const Index np = ppath.np;
+          const Index ns = stokes_dim;
+
+          // Point ip of ppath corresponds to point iv(ip) of ppath_vert
+          const bool upward = za_grid[i] < 90;
+          auto iv = [&](Index ip) { return upward ? np - 1 - ip : ip; };
+
+          ArrayOfTransmissionMatrix lyr_tra(np, TransmissionMatrix(nf, ns));
+          ArrayOfTransmissionMatrix dlyr_tra_dummy;
+          const ArrayOfPropagationMatrix dK_dummy;
+          for (Index ip = 1; ip < np; ip++) {
+            stepwise_transmission(lyr_tra[ip],
+                                  dlyr_tra_dummy,
+                                  dlyr_tra_dummy,
+                                  K_vert[iv(ip - 1)],
+                                  K_vert[iv(ip)],
+                                  dK_dummy,
+                                  dK_dummy,
+                                  ppath.lstep[ip - 1],
+                                  0,
+                                  0,
+                                  -1);
+          }
+          const ArrayOfTransmissionMatrix tot_tra =
+              cumulative_transmission(lyr_tra, CumulativeTransmission::Forward);
+
+          get_iy_of_background(wss,
+                               iy,
+                               diy_dx,
+                               Tensor3{tot_tra[np - 1]},
+                               iy_id,
+                               jacobian_do,
+                               jacobian_quantities,
+                               ppath,
+                               rte_pos2,
+                               atmosphere_dim,
+                               nlte_field,
+                               cloudbox_on,
+                               stokes_dim,
+                               f_grid,
+                               iy_unit,
+                               surface_props_data,
+                               iy_main_agenda,
+                               iy_space_agenda,
+                               iy_surface_agenda,
+                               iy_cloudbox_agenda,
+                               iy_agenda_call1,
+                               verbosity);
+
+          ArrayOfRadiationVector lvl_rad(np, RadiationVector(nf, ns));
+          ArrayOfRadiationVector dlvl_rad;
+          const ArrayOfRadiationVector dsrc_dummy;
+          lvl_rad[np - 1] = iy;
+          for (Index ip = np - 2; ip >= 0; ip--) {
+            lvl_rad[ip] = lvl_rad[ip + 1];
+            if (rt_integration_option == "first order" ||
+                rt_integration_option == "default") {
+              update_radiation_vector(lvl_rad[ip],
+                                      dlvl_rad,
+                                      dlvl_rad,
+                                      src_vert[iv(ip)],
+                                      src_vert[iv(ip + 1)],
+                                      dsrc_dummy,
+                                      dsrc_dummy,
+                                      lyr_tra[ip + 1],
+                                      tot_tra[ip],
+                                      dlyr_tra_dummy,
+                                      dlyr_tra_dummy,
+                                      PropagationMatrix(),
+                                      PropagationMatrix(),
+                                      ArrayOfPropagationMatrix(),
+                                      ArrayOfPropagationMatrix(),
+                                      Numeric(),
+                                      Vector(),
+                                      Vector(),
+                                      0,
+                                      0,
+                                      RadiativeTransferSolver::Emission);
+            } else if (rt_integration_option == "second order") {
+              update_radiation_vector(lvl_rad[ip],
+                                      dlvl_rad,
+                                      dlvl_rad,
+                                      src_vert[iv(ip)],
+                                      src_vert[iv(ip + 1)],
+                                      dsrc_dummy,
+                                      dsrc_dummy,
+                                      lyr_tra[ip + 1],
+                                      tot_tra[ip],
+                                      dlyr_tra_dummy,
+                                      dlyr_tra_dummy,
+                                      K_vert[iv(ip)],
+                                      K_vert[iv(ip + 1)],
+                                      dK_dummy,
+                                      dK_dummy,
+                                      ppath.lstep[ip],
+                                      Vector(),
+                                      Vector(),
+                                      0,
+                                      0,
+                                      RadiativeTransferSolver::LinearWeightedEmission);
+            } else {
+              ARTS_USER_ERROR ( "Only allowed choices for *integration order* are "
+                                "1 and 2.");
+            }
+          }
+
+          ppvar_iy.resize(nf, ns, np);
+          ppvar_trans_partial.resize(np, nf, ns, ns);
+          for (Index ip = 0; ip < np; ip++) {
+            ppvar_iy(joker, joker, ip) = lvl_rad[ip];
+            ppvar_trans_partial(ip, joker, joker, joker) = lyr_tra[ip];
+          }
+        } else {
+          iyEmissionStandard(wss,
+                             iy,
+                             iy_aux,
+                             diy_dx,
+                             ppvar_p,
+                             ppvar_t,
+                             ppvar_nlte,
+                             ppvar_vmr,
+                             ppvar_wind,
+                             ppvar_mag,
+                             ppvar_f,
+                             ppvar_iy,
+                             ppvar_trans_cumulat,
+                             ppvar_trans_partial,
+                             iy_id,
+                             stokes_dim,
+                             f_grid,
+                             atmosphere_dim,
+                             p_grid,
+                             t_field,
+                             nlte_field,
+                             vmr_field,
+                             abs_species,
+                             wind_u_field,
+                             wind_v_field,
+                             wind_w_field,
+                             mag_u_field,
+                             mag_v_field,
+                             mag_w_field,
+                             cloudbox_on,
+                             iy_unit,
+                             iy_aux_vars,
+                             jacobian_do,
+                             jacobian_quantities,
+                             ppath,
+                             rte_pos2,
+                             propmat_clearsky_agenda,
+                             water_p_eq_agenda,
+                             rt_integration_option,
+                             iy_main_agenda,
+                             iy_space_agenda,
+                             iy_surface_agenda,
+                             iy_cloudbox_agenda,
+                             iy_agenda_call1,
+                             iy_transmittance,
+                             rte_alonglos_v,
+                             surface_props_data,
+                             0,
+                             0,
+                             verbosity);
+          ARTS_ASSERT(iy.ncols() == stokes_dim);
+        }
 
         // First and last points are most easily handled separately
         if (za_grid[i] < 90) {
@@ -897,6 +1317,8 @@ void spectral_radiance_fieldExpandCloudboxField(
                            iy_transmittance,
                            rte_alonglos_v,
                            surface_props_data,
+                           0,
+                           0,
                            verbosity);
         ARTS_ASSERT(iy.ncols() == stokes_dim);
 
@@ -17,6 +17,7 @@
 #include <stdexcept>
 #include "arts.h"
 #include "arts_constants.h"
+#include "arts_omp.h"
 #include "arts_conversions.h"
 #include "auto_md.h"
 #include "check_input.h"
@@ -114,6 +115,8 @@ void MCGeneral(Workspace& ws,
                const Numeric& taustep_limit,
                const Index& l_mc_scat_order,
                const Index& t_interp_order,
+               const Index& parallel,
+               const Index& tabulated_sampling,
                const Verbosity& verbosity) {
   // Checks of input
   //
@@ -184,12 +187,8 @@ void MCGeneral(Workspace& ws,
     throw runtime_error(os.str());
   }
 
-  Ppath ppath_step;
-  RandomNumberGenerator<> rng;  //Random Number generator
   time_t start_time = time(NULL);
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   Vector Z11maxvector(
       N_se);  //Vector holding the maximum phase function for each
 
@@ -204,20 +203,20 @@ void MCGeneral(Workspace& ws,
     }
   }
 
-  rng.seed(mc_seed);
-
-  Numeric g, temperature, albedo, g_los_csc_theta;
-  Matrix A(stokes_dim, stokes_dim), Q(stokes_dim, stokes_dim);
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3),
-      R_stokes(stokes_dim, stokes_dim);  // Needed for antenna rotations
-  q = 0.0;
-  newQ = 0.0;
-  Vector vector1(stokes_dim), abs_vec_mono(stokes_dim), I_i(stokes_dim);
+  // Tables for sampling of scattering directions. Left empty if not
+  // requested, in which case Sample_los_tabulated uses rejection sampling
+  const MCPhaseFunctionTable pfct_table =
+      tabulated_sampling ? MCPhaseFunctionTable(scat_data, f_index)
+                         : MCPhaseFunctionTable{};
+  if (tabulated_sampling && !pfct_table.usable()) {
+    CREATE_OUT1;
+    out1 << "  Tabulated sampling requires totally randomly oriented "
+         << "particles,\n  with scattering angles covering 0-180 degrees.\n"
+         << "  Falling back to rejection sampling.\n";
+  }
+
+  Matrix R_ant2enu(3, 3);  // Needed for antenna rotations
   Vector Isum(stokes_dim), Isquaredsum(stokes_dim);
-  Index termination_flag = 0;
   const Numeric f_mono = f_grid[f_index];
   const Numeric prop_dir =
       -1.0;  // propagation direction opposite of los angles
@@ -236,15 +235,6 @@ void MCGeneral(Workspace& ws,
   mc_source_domain.resize(4);
   mc_source_domain = 0;
 
-  //local versions of workspace
-  Numeric local_surface_skin_t;
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Index np;
   Isum = 0.0;
   Isquaredsum = 0.0;
   Numeric std_err_i;
@@ -265,262 +255,363 @@ void MCGeneral(Workspace& ws,
   // Calculate rotation matrix for boresight
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
 
-  //Begin Main Loop
-  //
-  bool keepgoing, oksampling;
-  Index nfails = 0;
-  //
-  while (true) {
-    // Complete content of while inside try/catch to handle occasional
-    // failures in the ppath calculations
-    try {
-      bool inside_cloud;
+  // Outcome of tracing a single photon
+  struct Photon {
+    Vector I_i;
+    bool oksampling{true};  // gets false if g becomes zero
+    bool failed{false};
+    String error{};
+    Index source_domain{-1};
+    Index scattering_order{0};
+    Index ip{0}, ilat{0}, ilon{0};
+  };
+
+  // Traces a single photon. Only local variables, the given workspace and
+  // the given random number generator are modified, so the function can be
+  // called from several threads at once.
+  auto trace_photon = [&](Workspace& ws_photon,
+                          RandomNumberGenerator<>& rng,
+                          Photon& photon) {
+    Ppath ppath_step;
+    Vector pnd_vec(
+        N_se);  //Vector of particle number densities used at each point
+    Numeric g, temperature, albedo, g_los_csc_theta;
+    Matrix Q(stokes_dim, stokes_dim);
+    Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
+    Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
+    Matrix Z(stokes_dim, stokes_dim);
+    Matrix R_stokes(stokes_dim, stokes_dim);  // Needed for antenna rotations
+    q = 0.0;
+    newQ = 0.0;
+    Vector vector1(stokes_dim), abs_vec_mono(stokes_dim);
+    Index termination_flag = 0;
+
+    //local versions of workspace
+    Numeric local_surface_skin_t;
+    Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
+    Matrix local_surface_los;
+    Tensor4 local_surface_rmatrix;
+    Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
+    Vector local_rte_los(2);
+    Vector new_rte_los(2);
 
-      mc_iteration_count += 1;
-      Index scattering_order = 0;
-
-      keepgoing = true;   // indicating whether to continue tracing a photon
-      oksampling = true;  // gets false if g becomes zero
-
-      //Sample a FOV direction
-      Matrix R_prop(3, 3);
-      mc_antenna.draw_los(
-          local_rte_los, R_prop, rng, R_ant2enu, sensor_los(0, joker));
-
-      // Get stokes rotation matrix for rotating polarization
-      rotmat_stokes(
-          R_stokes, stokes_dim, prop_dir, prop_dir, R_prop, R_ant2enu);
-      id_mat(Q);
-      local_rte_pos = sensor_pos(0, joker);
-      I_i = 0.0;
-
-      while (keepgoing) {
-        mcPathTraceGeneral(ws,
-                           evol_op,
-                           abs_vec_mono,
-                           temperature,
-                           ext_mat_mono,
-                           rng,
-                           local_rte_pos,
-                           local_rte_los,
-                           pnd_vec,
-                           g,
-                           ppath_step,
-                           termination_flag,
-                           inside_cloud,
-                           ppath_step_agenda,
-                           ppath_lmax,
-                           ppath_lraytrace,
-                           taustep_limit,
-                           propmat_clearsky_agenda,
-                           stokes_dim,
-                           f_index,
-                           f_grid,
-                           p_grid,
-                           lat_grid,
-                           lon_grid,
-                           z_field,
-                           refellipsoid,
-                           z_surface,
-                           t_field,
-                           vmr_field,
-                           cloudbox_limits,
-                           pnd_field,
-                           scat_data,
-                           verbosity);
-
-        // GH 2011-09-08: if the lowest layer has large
-        // extent and a thick cloud, g may be 0 due to
-        // underflow, but then I_i should be 0 as well.
-        // Don't turn it into nan for no reason.
-        // If reaching underflow, no point in going on;
-        // hence new photon.
-        // GH 2011-09-14: moved this check to outside the different
-        // scenarios, as this goes wrong regardless of the scenario.
-        if (g == 0) {
-          keepgoing = false;
-          oksampling = false;
-          mc_iteration_count -= 1;
-          out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
-               << "happens repeatedly, try to decrease *ppath_lmax*)";
-        } else if (termination_flag == 1) {
-          iy_space_agendaExecute(ws,
-                                 local_iy,
-                                 Vector(1, f_mono),
-                                 local_rte_pos,
-                                 local_rte_los,
-                                 iy_space_agenda);
-          mult(vector1, evol_op, local_iy(0, joker));
+    bool inside_cloud;
+    bool keepgoing = true;  // indicating whether to continue tracing a photon
+    Vector& I_i = photon.I_i;
+    Index& scattering_order = photon.scattering_order;
+
+    //Sample a FOV direction
+    Matrix R_prop(3, 3);
+    mc_antenna.draw_los(
+        local_rte_los, R_prop, rng, R_ant2enu, sensor_los(0, joker));
+
+    // Get stokes rotation matrix for rotating polarization
+    rotmat_stokes(
+        R_stokes, stokes_dim, prop_dir, prop_dir, R_prop, R_ant2enu);
+    id_mat(Q);
+    local_rte_pos = sensor_pos(0, joker);
+    I_i.resize(stokes_dim);
+    I_i = 0.0;
+
+    while (keepgoing) {
+      mcPathTraceGeneral(ws_photon,
+                         evol_op,
+                         abs_vec_mono,
+                         temperature,
+                         ext_mat_mono,
+                         rng,
+                         local_rte_pos,
+                         local_rte_los,
+                         pnd_vec,
+                         g,
+                         ppath_step,
+                         termination_flag,
+                         inside_cloud,
+                         ppath_step_agenda,
+                         ppath_lmax,
+                         ppath_lraytrace,
+                         taustep_limit,
+                         propmat_clearsky_agenda,
+                         stokes_dim,
+                         f_index,
+                         f_grid,
+                         p_grid,
+                         lat_grid,
+                         lon_grid,
+                         z_field,
+                         refellipsoid,
+                         z_surface,
+                         t_field,
+                         vmr_field,
+                         cloudbox_limits,
+                         pnd_field,
+                         scat_data,
+                         verbosity);
+
+      // GH 2011-09-08: if the lowest layer has large
+      // extent and a thick cloud, g may be 0 due to
+      // underflow, but then I_i should be 0 as well.
+      // Don't turn it into nan for no reason.
+      // If reaching underflow, no point in going on;
+      // hence new photon.
+      // GH 2011-09-14: moved this check to outside the different
+      // scenarios, as this goes wrong regardless of the scenario.
+      if (g == 0) {
+        keepgoing = false;
+        photon.oksampling = false;
+      } else if (termination_flag == 1) {
+        iy_space_agendaExecute(ws_photon,
+                               local_iy,
+                               Vector(1, f_mono),
+                               local_rte_pos,
+                               local_rte_los,
+                               iy_space_agenda);
+        mult(vector1, evol_op, local_iy(0, joker));
+        mult(I_i, Q, vector1);
+        I_i /= g;
+        keepgoing = false;  //stop here. New photon.
+        photon.source_domain = 0;
+      } else if (termination_flag == 2) {
+        //Calculate surface properties
+        surface_rtprop_agendaExecute(ws_photon,
+                                     local_surface_skin_t,
+                                     local_surface_emission,
+                                     local_surface_los,
+                                     local_surface_rmatrix,
+                                     Vector(1, f_mono),
+                                     local_rte_pos,
+                                     local_rte_los,
+                                     surface_rtprop_agenda);
+
+        //if( local_surface_los.nrows() > 1 )
+        // throw runtime_error(
+        //                "The method handles only specular reflections." );
+
+        //deal with blackbody case
+        if (local_surface_los.empty()) {
+          mult(vector1, evol_op, local_surface_emission(0, joker));
           mult(I_i, Q, vector1);
           I_i /= g;
-          keepgoing = false;  //stop here. New photon.
-          mc_source_domain[0] += 1;
-        } else if (termination_flag == 2) {
-          //Calculate surface properties
-          surface_rtprop_agendaExecute(ws,
-                                       local_surface_skin_t,
-                                       local_surface_emission,
-                                       local_surface_los,
-                                       local_surface_rmatrix,
-                                       Vector(1, f_mono),
-                                       local_rte_pos,
-                                       local_rte_los,
-                                       surface_rtprop_agenda);
-
-          //if( local_surface_los.nrows() > 1 )
-          // throw runtime_error(
-          //                "The method handles only specular reflections." );
-
-          //deal with blackbody case
-          if (local_surface_los.empty()) {
+          keepgoing = false;
+          photon.source_domain = 1;
+        } else
+        //decide between reflection and emission
+        {
+          const Numeric rnd = rng.get(0.0, 1.0)();
+
+          Numeric R11 = 0;
+          for (Index i = 0; i < local_surface_rmatrix.nbooks(); i++) {
+            R11 += local_surface_rmatrix(i, 0, 0, 0);
+          }
+
+          if (rnd > R11) {
+            //then we have emission
             mult(vector1, evol_op, local_surface_emission(0, joker));
             mult(I_i, Q, vector1);
-            I_i /= g;
+            I_i /= g * (1 - R11);
             keepgoing = false;
-            mc_source_domain[1] += 1;
-          } else
-          //decide between reflection and emission
-          {
-            const Numeric rnd = rng.get(0.0, 1.0)();
-
-            Numeric R11 = 0;
-            for (Index i = 0; i < local_surface_rmatrix.nbooks(); i++) {
-              R11 += local_surface_rmatrix(i, 0, 0, 0);
-            }
-
-            if (rnd > R11) {
-              //then we have emission
-              mult(vector1, evol_op, local_surface_emission(0, joker));
-              mult(I_i, Q, vector1);
-              I_i /= g * (1 - R11);
-              keepgoing = false;
-              mc_source_domain[1] += 1;
-            } else {
-              //we have reflection
-              // determine which reflection los to use
-              Index i = 0;
-              Numeric rsum = local_surface_rmatrix(i, 0, 0, 0);
-              while (rsum < rnd) {
-                i++;
-                rsum += local_surface_rmatrix(i, 0, 0, 0);
-              }
-
-              local_rte_los = local_surface_los(i, joker);
-
-              mult(q, evol_op, local_surface_rmatrix(i, 0, joker, joker));
-              mult(newQ, Q, q);
-              Q = newQ;
-              Q /= g * local_surface_rmatrix(i, 0, 0, 0);
-            }
-          }
-        } else if (inside_cloud) {
-          //we have another scattering/emission point
-          //Estimate single scattering albedo
-          albedo = 1 - abs_vec_mono[0] / ext_mat_mono(0, 0);
-
-          //determine whether photon is emitted or scattered
-          if (rng.get(0.0, 1.0)() > albedo) {
-            //Calculate emission
-            Numeric planck_value = planck(f_mono, temperature);
-            Vector emission = abs_vec_mono;
-            emission *= planck_value;
-            Vector emissioncontri(stokes_dim);
-            mult(emissioncontri, evol_op, emission);
-            emissioncontri /= (g * (1 - albedo));  //yuck!
-            mult(I_i, Q, emissioncontri);
-            keepgoing = false;
-            mc_source_domain[3] += 1;
+            photon.source_domain = 1;
           } else {
-            //we have a scattering event
-            Sample_los(new_rte_los,
-                       g_los_csc_theta,
-                       Z,
-                       rng,
-                       local_rte_los,
-                       scat_data,
-                       f_index,
-                       stokes_dim,
-                       pnd_vec,
-                       Z11maxvector,
-                       ext_mat_mono(0, 0) - abs_vec_mono[0],
-                       temperature,
-                       t_interp_order);
+            //we have reflection
+            // determine which reflection los to use
+            Index i = 0;
+            Numeric rsum = local_surface_rmatrix(i, 0, 0, 0);
+            while (rsum < rnd) {
+              i++;
+              rsum += local_surface_rmatrix(i, 0, 0, 0);
+            }
 
-            Z /= g * g_los_csc_theta * albedo;
+            local_rte_los = local_surface_los(i, joker);
 
-            mult(q, evol_op, Z);
+            mult(q, evol_op, local_surface_rmatrix(i, 0, joker, joker));
             mult(newQ, Q, q);
             Q = newQ;
-            scattering_order += 1;
-            local_rte_los = new_rte_los;
+            Q /= g * local_surface_rmatrix(i, 0, 0, 0);
           }
-        } else {
-          //Must be clear sky emission point
+        }
+      } else if (inside_cloud) {
+        //we have another scattering/emission point
+        //Estimate single scattering albedo
+        albedo = 1 - abs_vec_mono[0] / ext_mat_mono(0, 0);
+
+        //determine whether photon is emitted or scattered
+        if (rng.get(0.0, 1.0)() > albedo) {
           //Calculate emission
           Numeric planck_value = planck(f_mono, temperature);
           Vector emission = abs_vec_mono;
           emission *= planck_value;
           Vector emissioncontri(stokes_dim);
           mult(emissioncontri, evol_op, emission);
-          emissioncontri /= g;
+          emissioncontri /= (g * (1 - albedo));  //yuck!
           mult(I_i, Q, emissioncontri);
           keepgoing = false;
-          mc_source_domain[2] += 1;
-        }
-      }  // keepgoing
-
-      if (oksampling) {
-        // Set spome of the bookkeeping variables
-        np = ppath_step.np;
-        mc_points(ppath_step.gp_p[np - 1].idx,
-                  ppath_step.gp_lat[np - 1].idx,
-                  ppath_step.gp_lon[np - 1].idx) += 1;
-        if (scattering_order < l_mc_scat_order) {
-          mc_scat_order[scattering_order] += 1;
+          photon.source_domain = 3;
+        } else {
+          //we have a scattering event
+          Sample_los_tabulated(new_rte_los,
+                               g_los_csc_theta,
+                               Z,
+                               rng,
+                               local_rte_los,
+                               pfct_table,
+                               scat_data,
+                               f_index,
+                               stokes_dim,
+                               pnd_vec,
+                               Z11maxvector,
+                               ext_mat_mono(0, 0) - abs_vec_mono[0],
+                               temperature,
+                               t_interp_order);
+
+          Z /= g * g_los_csc_theta * albedo;
+
+          mult(q, evol_op, Z);
+          mult(newQ, Q, q);
+          Q = newQ;
+          scattering_order += 1;
+          local_rte_los = new_rte_los;
         }
+      } else {
+        //Must be clear sky emission point
+        //Calculate emission
+        Numeric planck_value = planck(f_mono, temperature);
+        Vector emission = abs_vec_mono;
+        emission *= planck_value;
+        Vector emissioncontri(stokes_dim);
+        mult(emissioncontri, evol_op, emission);
+        emissioncontri /= g;
+        mult(I_i, Q, emissioncontri);
+        keepgoing = false;
+        photon.source_domain = 2;
+      }
+    }  // keepgoing
 
-        // Rotate into antenna polarization frame
-        Vector I_hold(stokes_dim);
-        mult(I_hold, R_stokes, I_i);
-        Isum += I_i;
+    if (photon.oksampling) {
+      const Index np = ppath_step.np;
+      photon.ip = ppath_step.gp_p[np - 1].idx;
+      photon.ilat = ppath_step.gp_lat[np - 1].idx;
+      photon.ilon = ppath_step.gp_lon[np - 1].idx;
+    }
+  };
 
-        for (Index j = 0; j < stokes_dim; j++) {
-          ARTS_ASSERT(!std::isnan(I_i[j]));
-          Isquaredsum[j] += I_i[j] * I_i[j];
-        }
-        y = Isum;
-        y /= (Numeric)mc_iteration_count;
-        for (Index j = 0; j < stokes_dim; j++) {
-          mc_error[j] = sqrt(
-              (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
-              (Numeric)mc_iteration_count);
-        }
-        if (std_err > 0 && mc_iteration_count >= min_iter &&
-            mc_error[0] < std_err_i) {
-          break;
-        }
-        if (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) {
-          break;
-        }
-        if (max_iter > 0 && mc_iteration_count >= max_iter) {
-          break;
-        }
-      }
-    }  // Try
+  // Adds a traced photon to the statistics. Returns true if any of the
+  // stopping criteria is met.
+  Index nfails = 0;
+  //
+  auto add_photon = [&](const Photon& photon) {
+    mc_iteration_count += 1;
 
-    catch (const std::runtime_error& e) {
+    if (photon.failed) {
       mc_iteration_count += 1;
       nfails += 1;
       out0 << "WARNING: A MC path sampling failed! Error was:\n";
-      cout << e.what() << endl;
+      cout << photon.error << endl;
       if (nfails >= 5) {
         throw runtime_error(
             "The MC path sampling has failed five times. A few failures "
             "should be OK, but this number is suspiciously high and the "
             "reason to these failures should be tracked down.");
       }
+      return false;
+    }
+
+    if (photon.source_domain >= 0) {
+      mc_source_domain[photon.source_domain] += 1;
+    }
+
+    if (!photon.oksampling) {
+      mc_iteration_count -= 1;
+      out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
+           << "happens repeatedly, try to decrease *ppath_lmax*)";
+      return false;
+    }
+
+    // Set spome of the bookkeeping variables
+    mc_points(photon.ip, photon.ilat, photon.ilon) += 1;
+    if (photon.scattering_order < l_mc_scat_order) {
+      mc_scat_order[photon.scattering_order] += 1;
     }
-  }  // while
+
+    Isum += photon.I_i;
+
+    for (Index j = 0; j < stokes_dim; j++) {
+      ARTS_ASSERT(!std::isnan(photon.I_i[j]));
+      Isquaredsum[j] += photon.I_i[j] * photon.I_i[j];
+    }
+    y = Isum;
+    y /= (Numeric)mc_iteration_count;
+    for (Index j = 0; j < stokes_dim; j++) {
+      mc_error[j] = sqrt(
+          (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
+          (Numeric)mc_iteration_count);
+    }
+    if (std_err > 0 && mc_iteration_count >= min_iter &&
+        mc_error[0] < std_err_i) {
+      return true;
+    }
+    if (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) {
+      return true;
+    }
+    if (max_iter > 0 && mc_iteration_count >= max_iter) {
+      return true;
+    }
+    return false;
+  };
+
+  //Begin Main Loop
+  //
+  if (!parallel) {
+    RandomNumberGenerator<> rng;  //Random Number generator
+    rng.seed(mc_seed);
+
+    while (true) {
+      // Failures in the ppath calculations are handled by add_photon
+      Photon photon;
+      try {
+        trace_photon(ws, rng, photon);
+      } catch (const std::runtime_error& e) {
+        photon.failed = true;
+        photon.error = e.what();
+      }
+      if (add_photon(photon)) break;
+    }
+  } else {
+    // Photons are traced in batches by all threads. Each photon has its own
+    // random number stream, and the photons are added to the statistics in
+    // order, checking the stopping criteria after each photon. Besides
+    // *mc_max_time*, the result is thus independent of the number of threads.
+    const bool threaded = !arts_omp_in_parallel();
+    const Index nthreads = threaded ? arts_omp_get_max_threads() : 1;
+    const Index nbatch = 32 * nthreads;
+    Array<Photon> batch(nbatch);
+
+    // One generator per thread, reseeded for every photon
+    std::vector<RandomNumberGenerator<>> rngs(nthreads);
+
+    WorkspaceOmpParallelCopyGuard wss{ws};
+
+    bool done = false;
+    for (Index first = 0; !done; first += nbatch) {
+#pragma omp parallel for if (threaded) schedule(dynamic) firstprivate(wss)
+      for (Index i = 0; i < nbatch; i++) {
+        RandomNumberGenerator<>& rng =
+            rngs[threaded ? arts_omp_get_thread_num() : 0];
+        rng.force_seed(mc_photon_seed(mc_seed, first + i));
+
+        batch[i] = Photon{};
+        try {
+          trace_photon(wss, rng, batch[i]);
+        } catch (const std::runtime_error& e) {
+          batch[i].failed = true;
+          batch[i].error = e.what();
+        }
+      }
+
+      for (Index i = 0; i < nbatch && !done; i++) {
+        done = add_photon(batch[i]);
+      }
+    }
+  }
 
   if (convert_to_rjbt) {
     for (Index j = 0; j < stokes_dim; j++) {
@@ -575,6 +666,7 @@ void MCRadar(  // Workspace reference:
     const Numeric& ze_tref,
     const Numeric& k2,
     const Index& t_interp_order,
+    const Index& parallel,
     // Verbosity object:
     const Verbosity& verbosity) {
   CREATE_OUT0;
@@ -657,43 +749,14 @@ void MCRadar(  // Workspace reference:
         "Gaussian antenna patterns.");
   }
 
-  Ppath ppath_step;
-  RandomNumberGenerator<> rng(mc_seed);                          //Random Number generator
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   bool anyptype_nonTotRan = is_anyptype_nonTotRan(scat_data);
   bool is_dist = max(range_bins) > 1;  // Is it round trip time or distance
-  
-  Numeric ppath_lraytrace_var;
-  //Numeric temperature, albedo;
-  Numeric albedo;
-  Numeric Csca, Cext;
-  Numeric antenna_wgt;
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix trans_mat(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3), R_enu2ant(3, 3), R_stokes(stokes_dim, stokes_dim);
-  Vector abs_vec_mono(stokes_dim), I_i(stokes_dim), I_i_rot(stokes_dim);
+
+  Matrix R_ant2enu(3, 3), R_enu2ant(3, 3);
   Vector Isum(nbins * stokes_dim), Isquaredsum(nbins * stokes_dim);
-  Index termination_flag = 0;
   Vector bin_height(nbins);
   Vector range_bin_count(nbins);
-  Index mc_iter;
-  Index scat_order;
-
-  // allocating variables needed for pha_mat extraction (don't want to do this
-  // in every loop step again).
-  ArrayOfArrayOfTensor6 pha_mat_Nse;
-  ArrayOfArrayOfIndex ptypes_Nse;
-  Matrix t_ok;
-  ArrayOfTensor6 pha_mat_ssbulk;
-  ArrayOfIndex ptype_ssbulk;
-  Tensor6 pha_mat_bulk;
-  Index ptype_bulk;
-  Matrix pdir_array(1, 2), idir_array(1, 2);
-  Vector t_array(1);
-  Matrix pnds(N_se, 1);
 
   // for pha_mat handling, at the moment we still need scat_data_mono. Hence,
   // extract that here (but in its local container, not into the WSV
@@ -717,23 +780,12 @@ void MCRadar(  // Workspace reference:
 
   range_bin_count = 0;
 
-  mc_iter = 0;
   // this will need to be reshaped differently for range gates
   mc_error.resize(stokes_dim * nbins);
+  mc_error = 0;
 
-  //local versions of workspace
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Vector Ipath(stokes_dim), Ihold(stokes_dim), Ipath_norm(stokes_dim);
   Isum = 0.0;
   Isquaredsum = 0.0;
-  Numeric s_tot, s_return;  // photon distance traveled
-  Numeric t_tot, t_return;  // photon time traveled
-  Numeric r_trav, r_bin;  // range traveled (1-way distance) or round-trip time
 
   Numeric fac;
   if (iy_unit_radar == "1") {
@@ -756,19 +808,111 @@ void MCRadar(  // Workspace reference:
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
   R_enu2ant = transpose(R_ant2enu);
 
-  //Begin Main Loop
-  bool keepgoing, firstpass, integrity;
-  while (mc_iter < mc_max_iter) {
-    bool inside_cloud;
+  // Work arrays of the photon tracing. They are allocated once per serial
+  // run or per block of photons, and are completely overwritten for each
+  // photon.
+  struct PhotonScratch {
+    PhotonScratch(const Index n_se, const Index nstokes)
+        : pnd_vec(n_se),
+          evol_op(nstokes, nstokes),
+          ext_mat_mono(nstokes, nstokes),
+          trans_mat(nstokes, nstokes),
+          Z(nstokes, nstokes),
+          P(nstokes, nstokes),
+          R_stokes(nstokes, nstokes),
+          R_tx(3, 3),
+          R_rx(3, 3),
+          abs_vec_mono(nstokes),
+          I_i(nstokes),
+          I_i_rot(nstokes),
+          pdir_array(1, 2),
+          idir_array(1, 2),
+          t_array(1),
+          pnds(n_se, 1),
+          local_rte_pos(3),
+          local_rte_los(2),
+          new_rte_los(2),
+          rte_los_geom(2),
+          rte_los_antenna(2),
+          Ipath(nstokes),
+          Ihold(nstokes) {}
+
+    Ppath ppath_step, ppath;
+    Vector pnd_vec;
+    Matrix evol_op, ext_mat_mono, trans_mat, Z, P, R_stokes, R_tx, R_rx;
+    Vector abs_vec_mono, I_i, I_i_rot;
+    ArrayOfArrayOfTensor6 pha_mat_Nse;
+    ArrayOfArrayOfIndex ptypes_Nse;
+    Matrix t_ok;
+    ArrayOfTensor6 pha_mat_ssbulk;
+    ArrayOfIndex ptype_ssbulk;
+    Tensor6 pha_mat_bulk;
+    Matrix pdir_array, idir_array;
+    Vector t_array;
+    Matrix pnds;
+    Vector local_rte_pos, local_rte_los, new_rte_los, rte_los_geom,
+        rte_los_antenna;
+    Vector Ipath, Ihold;
+  };
+
+  // Traces a single photon and adds its contributions to the given range
+  // bin accumulators. Besides these, only the work arrays, the workspace and
+  // the random number generator are modified.
+  auto trace_photon = [&](Workspace& ws_photon,
+                          RandomNumberGenerator<>& rng,
+                          PhotonScratch& scratch,
+                          VectorView Isum_photon,
+                          VectorView Isquaredsum_photon,
+                          VectorView range_bin_count_photon) {
+    Ppath& ppath_step = scratch.ppath_step;
+    Vector& pnd_vec = scratch.pnd_vec;  //Particle number densities of a point
+    Numeric ppath_lraytrace_var;
+    Numeric albedo;
+    Numeric Csca, Cext;
+    Numeric antenna_wgt;
+    Matrix& evol_op = scratch.evol_op;
+    Matrix& ext_mat_mono = scratch.ext_mat_mono;
+    Matrix& trans_mat = scratch.trans_mat;
+    Matrix& Z = scratch.Z;
+    Matrix& R_stokes = scratch.R_stokes;
+    Vector& abs_vec_mono = scratch.abs_vec_mono;
+    Vector& I_i = scratch.I_i;
+    Vector& I_i_rot = scratch.I_i_rot;
+    Index termination_flag = 0;
+    Index scat_order;
+
+    // variables needed for pha_mat extraction
+    ArrayOfArrayOfTensor6& pha_mat_Nse = scratch.pha_mat_Nse;
+    ArrayOfArrayOfIndex& ptypes_Nse = scratch.ptypes_Nse;
+    Matrix& t_ok = scratch.t_ok;
+    ArrayOfTensor6& pha_mat_ssbulk = scratch.pha_mat_ssbulk;
+    ArrayOfIndex& ptype_ssbulk = scratch.ptype_ssbulk;
+    Tensor6& pha_mat_bulk = scratch.pha_mat_bulk;
+    Index ptype_bulk;
+    Matrix& pdir_array = scratch.pdir_array;
+    Matrix& idir_array = scratch.idir_array;
+    Vector& t_array = scratch.t_array;
+    Matrix& pnds = scratch.pnds;
+
+    //local versions of workspace
+    Vector& local_rte_pos = scratch.local_rte_pos;
+    Vector& local_rte_los = scratch.local_rte_los;
+    Vector& new_rte_los = scratch.new_rte_los;
+    Vector& Ipath = scratch.Ipath;
+    Vector& Ihold = scratch.Ihold;
+    Numeric s_tot, s_return;  // photon distance traveled
+    Numeric t_tot, t_return;  // photon time traveled
+    Numeric r_trav, r_bin;  // range traveled (1-way distance) or round-trip time
 
-    mc_iter += 1;
+    bool inside_cloud;
+    bool keepgoing, firstpass, integrity;
 
     integrity = true;  // intensity is not nan or below threshold
     keepgoing = true;  // indicating whether to continue tracing a photon
     firstpass = true;  // ensure backscatter is properly calculated
 
     //Sample a FOV direction
-    Matrix R_tx(3, 3);
+    Matrix& R_tx = scratch.R_tx;
     mc_antenna.draw_los(
         local_rte_los, R_tx, rng, R_ant2enu, sensor_los(0, joker));
     rotmat_stokes(R_stokes, stokes_dim, tx_dir, tx_dir, R_ant2enu, R_tx);
@@ -782,7 +926,7 @@ void MCRadar(  // Workspace reference:
     while (keepgoing) {
       Numeric s_path, t_path;
 
-      mcPathTraceRadar(ws,
+      mcPathTraceRadar(ws_photon,
                        evol_op,
                        abs_vec_mono,
                        t_array[0],
@@ -841,7 +985,7 @@ void MCRadar(  // Workspace reference:
           continue;
         }
 
-        Vector rte_los_geom(2);
+        Vector& rte_los_geom = scratch.rte_los_geom;
 
         // Compute reflectivity contribution based on local-to-sensor
         // geometry, path attenuation
@@ -869,8 +1013,8 @@ void MCRadar(  // Workspace reference:
         // weighting of return signal and ppath to determine
         // propagation path back to sensor
         // Replace with ppath_agendaExecute??
-        Ppath ppath;
-        Vector rte_los_antenna(2);
+        Ppath& ppath = scratch.ppath;
+        Vector& rte_los_antenna = scratch.rte_los_antenna;
         ppath_lraytrace_var = ppath_lraytrace;
         Numeric za_accuracy = 2e-5;
         Numeric pplrt_factor = 5;
@@ -885,7 +1029,7 @@ void MCRadar(  // Workspace reference:
                                             local_rte_pos,
                                             verbosity);
 
-        ppathFromRtePos2(ws,
+        ppathFromRtePos2(ws_photon,
                          ppath,
                          rte_los_antenna,
                          ppath_lraytrace_var,
@@ -930,7 +1074,7 @@ void MCRadar(  // Workspace reference:
         // Still within max range of radar?
         if (r_trav <= r_max) {
           // Compute path extinction as with radio link
-          get_ppath_transmat(ws,
+          get_ppath_transmat(ws_photon,
                              trans_mat,
                              ppath,
                              propmat_clearsky_agenda,
@@ -946,7 +1090,7 @@ void MCRadar(  // Workspace reference:
                              verbosity);
 
           // Obtain scattering matrix given incident and scattered angles
-          Matrix P(stokes_dim, stokes_dim);
+          Matrix& P = scratch.P;
 
           pdir_array(0, joker) = rte_los_geom;
           idir_array(0, joker) = local_rte_los;
@@ -997,7 +1141,7 @@ void MCRadar(  // Workspace reference:
             ibin -= 1;
 
             // Calculate rx antenna weight and polarization rotation
-            Matrix R_rx(3, 3);
+            Matrix& R_rx = scratch.R_rx;
             rotmat_enu(R_rx, rte_los_antenna);
             mc_antenna.return_los(antenna_wgt, R_rx, R_enu2ant);
             rotmat_stokes(
@@ -1007,11 +1151,11 @@ void MCRadar(  // Workspace reference:
             for (Index istokes = 0; istokes < stokes_dim; istokes++) {
               Index ibiny = ibin * stokes_dim + istokes;
               ARTS_ASSERT(!std::isnan(I_i_rot[istokes]));
-              Isum[ibiny] += antenna_wgt * I_i_rot[istokes];
-              Isquaredsum[ibiny] += antenna_wgt * antenna_wgt *
-                                    I_i_rot[istokes] * I_i_rot[istokes];
+              Isum_photon[ibiny] += antenna_wgt * I_i_rot[istokes];
+              Isquaredsum_photon[ibiny] += antenna_wgt * antenna_wgt *
+                                           I_i_rot[istokes] * I_i_rot[istokes];
             }
-            range_bin_count[ibin] += 1;
+            range_bin_count_photon[ibin] += 1;
           }
 
           scat_order++;
@@ -1060,18 +1204,77 @@ void MCRadar(  // Workspace reference:
       if (!integrity) keepgoing = false;
     }  // while (inner: keepgoing)
 
-  }  // while (outer)
+  };
+
+  //Begin Main Loop
+  if (!parallel) {
+    RandomNumberGenerator<> rng(mc_seed);  //Random Number generator
+    PhotonScratch scratch(N_se, stokes_dim);
+
+    for (Index mc_iter = 0; mc_iter < mc_max_iter; mc_iter++) {
+      trace_photon(ws, rng, scratch, Isum, Isquaredsum, range_bin_count);
+    }
+  } else {
+    // Photons are split into a fixed number of blocks, independent of the
+    // number of threads. Each block accumulates into its own range bin
+    // histograms, and each photon has its own random number stream. The
+    // block histograms are summed in order at the end, so the result does
+    // not depend on the number of threads.
+    const Index nblocks = min(mc_max_iter, Index{256});
+    Tensor3 block_sum(nblocks, 2, nbins * stokes_dim, 0.0);
+    Matrix block_count(nblocks, nbins, 0.0);
+
+    String fail_msg;
+    bool failed = false;
+
+    WorkspaceOmpParallelCopyGuard wss{ws};
+
+#pragma omp parallel for if (!arts_omp_in_parallel()) schedule(dynamic) \
+    firstprivate(wss)
+    for (Index iblock = 0; iblock < nblocks; iblock++) {
+      if (failed) continue;
+      try {
+        RandomNumberGenerator<> rng;
+        PhotonScratch scratch(N_se, stokes_dim);
+        for (Index mc_iter = iblock * mc_max_iter / nblocks;
+             mc_iter < (iblock + 1) * mc_max_iter / nblocks;
+             mc_iter++) {
+          rng.force_seed(mc_photon_seed(mc_seed, mc_iter));
+          trace_photon(wss,
+                       rng,
+                       scratch,
+                       block_sum(iblock, 0, joker),
+                       block_sum(iblock, 1, joker),
+                       block_count(iblock, joker));
+        }
+      } catch (const std::exception& e) {
+#pragma omp critical(MCRadar_fail)
+        {
+          fail_msg = e.what();
+          failed = true;
+        }
+      }
+    }
+
+    ARTS_USER_ERROR_IF(failed, fail_msg);
+
+    for (Index iblock = 0; iblock < nblocks; iblock++) {
+      Isum += block_sum(iblock, 0, joker);
+      Isquaredsum += block_sum(iblock, 1, joker);
+      range_bin_count += block_count(iblock, joker);
+    }
+  }
 
   // Normalize range bins and apply sensor response (polarization)
   for (Index ibin = 0; ibin < nbins; ibin++) {
     for (Index istokes = 0; istokes < stokes_dim; istokes++) {
       Index ibiny = ibin * stokes_dim + istokes;
       if (range_bin_count[ibin] > 0) {
-        y[ibiny] = Isum[ibiny] / ((Numeric)mc_iter) / bin_height[ibin];
-        mc_error[ibiny] = sqrt((Isquaredsum[ibiny] / (Numeric)mc_iter /
+        y[ibiny] = Isum[ibiny] / ((Numeric)mc_max_iter) / bin_height[ibin];
+        mc_error[ibiny] = sqrt((Isquaredsum[ibiny] / (Numeric)mc_max_iter /
                                     bin_height[ibin] / bin_height[ibin] -
                                 y[ibiny] * y[ibiny]) /
-                               (Numeric)mc_iter);
+                               (Numeric)mc_max_iter);
       }
     }
   }
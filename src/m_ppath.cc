@@ -15,6 +15,7 @@
 
 #include <cmath>
 #include "arts.h"
+#include "arts_omp.h"
 #include "arts_conversions.h"
 #include "auto_md.h"
 #include "check_input.h"
@@ -1640,6 +1641,78 @@ void ppathStepByStep(Workspace& ws,
              verbosity);
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppathFromPpathField(Workspace& ws,
+                         Ppath& ppath,
+                         const ArrayOfPpath& ppath_field,
+                         const ArrayOfString& ppath_field_settings,
+                         const Agenda& ppath_step_agenda,
+                         const Index& ppath_inside_cloudbox_do,
+                         const Index& atmosphere_dim,
+                         const Vector& p_grid,
+                         const Vector& lat_grid,
+                         const Vector& lon_grid,
+                         const Tensor3& z_field,
+                         const Vector& f_grid,
+                         const Vector& refellipsoid,
+                         const Matrix& z_surface,
+                         const Index& cloudbox_on,
+                         const ArrayOfIndex& cloudbox_limits,
+                         const Vector& rte_pos,
+                         const Vector& rte_los,
+                         const Numeric& ppath_lmax,
+                         const Numeric& ppath_lraytrace,
+                         const Verbosity& verbosity) {
+  // Paths inside the cloudbox are never part of a ppath_field
+  if (!ppath_inside_cloudbox_do && !ppath_field.empty()) {
+    ppath_field_check_settings(
+        ppath_field_settings,
+        ppath_field,
+        ppath_field_settings_describe(ws,
+                                      ppath_step_agenda,
+                                      atmosphere_dim,
+                                      f_grid,
+                                      refellipsoid,
+                                      cloudbox_on,
+                                      cloudbox_limits,
+                                      ppath_lmax,
+                                      ppath_lraytrace));
+  }
+
+  Index index;
+  if (!ppath_inside_cloudbox_do && !ppath_field.empty() &&
+      ppath_find_in_field(index,
+                          ppath_field,
+                          ppath_field_settings[0],
+                          atmosphere_dim,
+                          rte_pos,
+                          rte_los)) {
+    ppath_check_field_path(ppath_field[index], atmosphere_dim, z_field);
+    ppath = ppath_field[index];
+    return;
+  }
+
+  ppath_calc(ws,
+             ppath,
+             ppath_step_agenda,
+             atmosphere_dim,
+             p_grid,
+             lat_grid,
+             lon_grid,
+             z_field,
+             f_grid,
+             refellipsoid,
+             z_surface,
+             cloudbox_on,
+             cloudbox_limits,
+             rte_pos,
+             rte_los,
+             ppath_lmax,
+             ppath_lraytrace,
+             ppath_inside_cloudbox_do,
+             verbosity);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ppathWriteXMLPartial(  //WS Input:
     const String& file_format,
@@ -1672,6 +1745,7 @@ void ppathWriteXMLPartial(  //WS Input:
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ppath_fieldFromDownUpLimbGeoms(Workspace& ws,
                                     ArrayOfPpath& ppath_field,
+                                    ArrayOfString& ppath_field_settings,
                                     const Agenda& ppath_agenda,
                                     const Numeric& ppath_lmax,
                                     const Numeric& ppath_lraytrace,
@@ -1706,6 +1780,7 @@ void ppath_fieldFromDownUpLimbGeoms(Workspace& ws,
   const Numeric top_tangent = 90 - 1e-4;
 
   ppath_field.resize(3 * zenith_angles_per_position);
+  ppath_field_settings.resize(0);
   Index ppath_field_pos = 0;
 
   Vector zenith_angles(zenith_angles_per_position);
@@ -1791,6 +1866,7 @@ void ppath_fieldFromDownUpLimbGeoms(Workspace& ws,
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ppath_fieldCalc(Workspace& ws,
                      ArrayOfPpath& ppath_field,
+                     ArrayOfString& ppath_field_settings,
                      const Agenda& ppath_agenda,
                      const Numeric& ppath_lmax,
                      const Numeric& ppath_lraytrace,
@@ -1805,25 +1881,146 @@ void ppath_fieldCalc(Workspace& ws,
                      const Verbosity& verbosity) {
   auto n = sensor_pos.nrows();
   ppath_field.resize(n);
+  ppath_field_settings.resize(0);
 
   ARTS_USER_ERROR_IF (sensor_los.nrows() not_eq n,
         "Your sensor position matrix and sensor line of sight matrix do not match in size.\n");
 
-  for (auto i = 0; i < n; i++)
-    ppathCalc(ws,
-              ppath_field[i],
-              ppath_agenda,
-              ppath_lmax,
-              ppath_lraytrace,
-              atmgeom_checked,
-              f_grid,
-              cloudbox_on,
-              cloudbox_checked,
-              ppath_inside_cloudbox_do,
-              Vector{sensor_pos(i, joker)},
-              Vector{sensor_los(i, joker)},
-              rte_pos2,
-              verbosity);
+  String fail_msg;
+  bool failed = false;
+  WorkspaceOmpParallelCopyGuard wss{ws};
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n > 1) \
+    firstprivate(wss) schedule(dynamic)
+  for (Index i = 0; i < n; i++) {
+    // Skip remaining iterations if an error occurred
+    if (failed) continue;
+
+    try {
+      ppathCalc(wss,
+                ppath_field[i],
+                ppath_agenda,
+                ppath_lmax,
+                ppath_lraytrace,
+                atmgeom_checked,
+                f_grid,
+                cloudbox_on,
+                cloudbox_checked,
+                ppath_inside_cloudbox_do,
+                Vector{sensor_pos(i, joker)},
+                Vector{sensor_los(i, joker)},
+                rte_pos2,
+                verbosity);
+    } catch (const std::exception& e) {
+#pragma omp critical(ppath_fieldCalc_fail)
+      {
+        failed = true;
+        fail_msg = e.what();
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppath_fieldStepByStep(Workspace& ws,
+                           ArrayOfPpath& ppath_field,
+                           ArrayOfString& ppath_field_settings,
+                           const Agenda& ppath_step_agenda,
+                           const Index& ppath_inside_cloudbox_do,
+                           const Index& atmosphere_dim,
+                           const Vector& p_grid,
+                           const Vector& lat_grid,
+                           const Vector& lon_grid,
+                           const Tensor3& z_field,
+                           const Vector& f_grid,
+                           const Vector& refellipsoid,
+                           const Matrix& z_surface,
+                           const Index& atmgeom_checked,
+                           const Index& cloudbox_on,
+                           const ArrayOfIndex& cloudbox_limits,
+                           const Index& cloudbox_checked,
+                           const Matrix& sensor_pos,
+                           const Matrix& sensor_los,
+                           const Matrix& mblock_dlos,
+                           const Numeric& ppath_lmax,
+                           const Numeric& ppath_lraytrace,
+                           const Verbosity& verbosity) {
+  ARTS_USER_ERROR_IF(atmgeom_checked != 1,
+                     "The atmospheric geometry must be flagged to have "
+                     "passed a consistency check (atmgeom_checked=1).");
+  ARTS_USER_ERROR_IF(cloudbox_checked != 1,
+                     "The cloudbox must be flagged to have "
+                     "passed a consistency check (cloudbox_checked=1).");
+  ARTS_USER_ERROR_IF(sensor_los.nrows() != sensor_pos.nrows(),
+                     "Your sensor position matrix and sensor line of sight "
+                     "matrix do not match in size.");
+  ARTS_USER_ERROR_IF(mblock_dlos.empty(), "*mblock_dlos* is empty.");
+  ARTS_USER_ERROR_IF(mblock_dlos.ncols() > 2,
+                     "The maximum number of columns in *mblock_dlos* is two.");
+  ARTS_USER_ERROR_IF(
+      atmosphere_dim < 3 && mblock_dlos.ncols() != 1,
+      "For 1D and 2D, *mblock_dlos* must have exactly one column.");
+
+  // Positions and LOS set up in the same way as done by yCalc
+  const Index nmblock = sensor_pos.nrows();
+  const Index nlos = mblock_dlos.nrows();
+  Matrix rte_pos(nmblock * nlos, sensor_pos.ncols());
+  Matrix rte_los(nmblock * nlos, sensor_los.ncols());
+  //
+  for (Index mblock_index = 0; mblock_index < nmblock; mblock_index++) {
+    for (Index ilos = 0; ilos < nlos; ilos++) {
+      const Index i = mblock_index * nlos + ilos;
+      rte_pos(i, joker) = sensor_pos(mblock_index, joker);
+      Vector los{sensor_los(mblock_index, joker)};
+      if (mblock_dlos.ncols() == 1) {
+        los[0] += mblock_dlos(ilos, 0);
+        adjust_los(los, atmosphere_dim);
+      } else {
+        add_za_aa(los[0],
+                  los[1],
+                  los[0],
+                  los[1],
+                  mblock_dlos(ilos, 0),
+                  mblock_dlos(ilos, 1));
+      }
+      rte_los(i, joker) = los;
+    }
+  }
+
+  ppath_calc_batch(ws,
+                   ppath_field,
+                   ppath_step_agenda,
+                   atmosphere_dim,
+                   p_grid,
+                   lat_grid,
+                   lon_grid,
+                   z_field,
+                   f_grid,
+                   refellipsoid,
+                   z_surface,
+                   cloudbox_on,
+                   cloudbox_limits,
+                   rte_pos,
+                   rte_los,
+                   ppath_lmax,
+                   ppath_lraytrace,
+                   ppath_inside_cloudbox_do,
+                   verbosity);
+
+  // Recorded for ppathFromPpathField
+  ppath_field_settings = ppath_field_settings_describe(ws,
+                                                       ppath_step_agenda,
+                                                       atmosphere_dim,
+                                                       f_grid,
+                                                       refellipsoid,
+                                                       cloudbox_on,
+                                                       cloudbox_limits,
+                                                       ppath_lmax,
+                                                       ppath_lraytrace);
+  ppath_field_settings.insert(ppath_field_settings.begin(),
+                              ppath_field_id(ppath_field.nelem()));
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -1884,23 +2081,28 @@ void ppath_stepGeometric(  // WS Output:
   }
 }
 
-/* Workspace method: Doxygen documentation will be auto-generated */
-void ppath_stepRefractionBasic(Workspace& ws,
-                               Ppath& ppath_step,
-                               const Agenda& refr_index_air_agenda,
-                               const Index& atmosphere_dim,
-                               const Vector& p_grid,
-                               const Vector& lat_grid,
-                               const Vector& lon_grid,
-                               const Tensor3& z_field,
-                               const Tensor3& t_field,
-                               const Tensor4& vmr_field,
-                               const Vector& refellipsoid,
-                               const Matrix& z_surface,
-                               const Vector& f_grid,
-                               const Numeric& ppath_lmax,
-                               const Numeric& ppath_lraytrace,
-                               const Verbosity&) {
+//! ppath_step_refraction_basic
+/*!
+   Common part of *ppath_stepRefractionBasic* and *ppath_stepRefractionField*.
+   The refractive index is taken from *refr_index_air_field* if this
+   argument is non-empty, and otherwise from *refr_index_air_agenda*.
+*/
+static void ppath_step_refraction_basic(Workspace& ws,
+                                        Ppath& ppath_step,
+                                        const Agenda& refr_index_air_agenda,
+                                        ConstTensor4View refr_index_air_field,
+                                        const Index& atmosphere_dim,
+                                        const Vector& p_grid,
+                                        const Vector& lat_grid,
+                                        const Vector& lon_grid,
+                                        const Tensor3& z_field,
+                                        const Tensor3& t_field,
+                                        const Tensor4& vmr_field,
+                                        const Vector& refellipsoid,
+                                        const Matrix& z_surface,
+                                        const Vector& f_grid,
+                                        const Numeric& ppath_lmax,
+                                        const Numeric& ppath_lraytrace) {
   // Input checks here would be rather costly as this function is called
   // many times.
   ARTS_ASSERT(ppath_lraytrace > 0);
@@ -1920,6 +2122,7 @@ void ppath_stepRefractionBasic(Workspace& ws,
                          z_surface(0, 0),
                          ppath_lmax,
                          refr_index_air_agenda,
+                         refr_index_air_field,
                          "linear_basic",
                          ppath_lraytrace);
     } else if (atmosphere_dim == 2) {
@@ -1935,6 +2138,7 @@ void ppath_stepRefractionBasic(Workspace& ws,
                          z_surface(joker, 0),
                          ppath_lmax,
                          refr_index_air_agenda,
+                         refr_index_air_field,
                          "linear_basic",
                          ppath_lraytrace);
     } else if (atmosphere_dim == 3) {
@@ -1951,6 +2155,7 @@ void ppath_stepRefractionBasic(Workspace& ws,
                          z_surface,
                          ppath_lmax,
                          refr_index_air_agenda,
+                         refr_index_air_field,
                          "linear_basic",
                          ppath_lraytrace);
     } else {
@@ -1965,6 +2170,7 @@ void ppath_stepRefractionBasic(Workspace& ws,
                         ppath_step.nreal[0],
                         ppath_step.ngroup[0],
                         refr_index_air_agenda,
+                        refr_index_air_field,
                         p_grid,
                         refellipsoid,
                         z_field,
@@ -1977,6 +2183,7 @@ void ppath_stepRefractionBasic(Workspace& ws,
                         ppath_step.nreal[0],
                         ppath_step.ngroup[0],
                         refr_index_air_agenda,
+                        refr_index_air_field,
                         p_grid,
                         lat_grid,
                         refellipsoid,
@@ -1991,6 +2198,7 @@ void ppath_stepRefractionBasic(Workspace& ws,
                         ppath_step.nreal[0],
                         ppath_step.ngroup[0],
                         refr_index_air_agenda,
+                        refr_index_air_field,
                         p_grid,
                         lat_grid,
                         lon_grid,
@@ -2006,6 +2214,83 @@ void ppath_stepRefractionBasic(Workspace& ws,
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppath_stepRefractionBasic(Workspace& ws,
+                               Ppath& ppath_step,
+                               const Agenda& refr_index_air_agenda,
+                               const Index& atmosphere_dim,
+                               const Vector& p_grid,
+                               const Vector& lat_grid,
+                               const Vector& lon_grid,
+                               const Tensor3& z_field,
+                               const Tensor3& t_field,
+                               const Tensor4& vmr_field,
+                               const Vector& refellipsoid,
+                               const Matrix& z_surface,
+                               const Vector& f_grid,
+                               const Numeric& ppath_lmax,
+                               const Numeric& ppath_lraytrace,
+                               const Verbosity&) {
+  ppath_step_refraction_basic(ws,
+                              ppath_step,
+                              refr_index_air_agenda,
+                              Tensor4{},
+                              atmosphere_dim,
+                              p_grid,
+                              lat_grid,
+                              lon_grid,
+                              z_field,
+                              t_field,
+                              vmr_field,
+                              refellipsoid,
+                              z_surface,
+                              f_grid,
+                              ppath_lmax,
+                              ppath_lraytrace);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppath_stepRefractionField(Workspace& ws,
+                               Ppath& ppath_step,
+                               const Tensor4& refr_index_air_field,
+                               const Index& atmosphere_dim,
+                               const Vector& p_grid,
+                               const Vector& lat_grid,
+                               const Vector& lon_grid,
+                               const Tensor3& z_field,
+                               const Vector& refellipsoid,
+                               const Matrix& z_surface,
+                               const Numeric& ppath_lmax,
+                               const Numeric& ppath_lraytrace,
+                               const Verbosity&) {
+  // Only sizes are checked, as the function is called many times
+  ARTS_USER_ERROR_IF(
+      !is_size(refr_index_air_field,
+               2,
+               p_grid.nelem(),
+               std::max(Index(1), lat_grid.nelem()),
+               std::max(Index(1), lon_grid.nelem())),
+      "*refr_index_air_field* does not match the atmospheric grids.\n"
+      "Did you forget to call *refr_index_air_fieldCalc*?")
+
+  ppath_step_refraction_basic(ws,
+                              ppath_step,
+                              Agenda{},
+                              refr_index_air_field,
+                              atmosphere_dim,
+                              p_grid,
+                              lat_grid,
+                              lon_grid,
+                              z_field,
+                              Tensor3{},
+                              Tensor4{},
+                              refellipsoid,
+                              z_surface,
+                              Vector{},
+                              ppath_lmax,
+                              ppath_lraytrace);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void rte_losReverse(
     Vector& rte_los,
@@ -2410,6 +2695,7 @@ void VectorZtanToZaRefr1D(Workspace& ws,
                       refr_index_air,
                       refr_index_air_group,
                       refr_index_air_agenda,
+                      Tensor4{},
                       p_grid,
                       ConstVectorView{refellipsoid[0]},
                       z_field,
@@ -55,6 +55,7 @@ void line_irradianceCalcForSingleSpeciesNonOverlappingLinesPseudo2D(
   FieldOfPropagationMatrix propmat_field;
   FieldOfStokesVector absorption_field, additional_source_field;
   ArrayOfPpath ppath_field;
+  ArrayOfString ppath_field_settings;
 
   // Check that the lines and nf is correct
   Vector f_grid(nf * nl);
@@ -72,6 +73,7 @@ void line_irradianceCalcForSingleSpeciesNonOverlappingLinesPseudo2D(
 
   ppath_fieldFromDownUpLimbGeoms(ws,
                                  ppath_field,
+                                 ppath_field_settings,
                                  ppath_agenda,
                                  -1,
                                  1e99,
@@ -22,6 +22,8 @@
 #include "species_tags.h"
 #include "absorption.h"
 #include "arts.h"
+#include "arts_omp.h"
+#include "auto_md.h"
 #include "check_input.h"
 #include "math_funcs.h"
 #include "matpack_data.h"
@@ -284,6 +286,73 @@ void refr_index_airMicrowavesGeneral(
   refr_index_air_group += n;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void refr_index_air_fieldCalc(Workspace& ws,
+                              Tensor4& refr_index_air_field,
+                              const Agenda& refr_index_air_agenda,
+                              const Index& atmosphere_dim,
+                              const Vector& p_grid,
+                              const Vector& lat_grid,
+                              const Vector& lon_grid,
+                              const Tensor3& t_field,
+                              const Tensor4& vmr_field,
+                              const Vector& f_grid,
+                              const Verbosity&) {
+  chk_if_in_range("atmosphere_dim", atmosphere_dim, 1, 3);
+  chk_atm_grids(atmosphere_dim, p_grid, lat_grid, lon_grid);
+  chk_atm_field("t_field", t_field, atmosphere_dim, p_grid, lat_grid, lon_grid);
+  chk_atm_field("vmr_field",
+                vmr_field,
+                atmosphere_dim,
+                vmr_field.nbooks(),
+                p_grid,
+                lat_grid,
+                lon_grid);
+
+  const Index np = t_field.npages();
+  const Index nlat = t_field.nrows();
+  const Index nlon = t_field.ncols();
+  const Index ns = vmr_field.nbooks();
+
+  refr_index_air_field.resize(2, np, nlat, nlon);
+
+  String fail_msg;
+  bool failed = false;
+
+  WorkspaceOmpParallelCopyGuard wss{ws};
+
+#pragma omp parallel for if (!arts_omp_in_parallel()) firstprivate(wss)
+  for (Index i = 0; i < np * nlat * nlon; i++) {
+    if (failed) continue;
+    try {
+      const Index ip = i / (nlat * nlon);
+      const Index ilat = (i / nlon) % nlat;
+      const Index ilon = i % nlon;
+
+      Vector rtp_vmr(ns);
+      for (Index is = 0; is < ns; is++)
+        rtp_vmr[is] = vmr_field(is, ip, ilat, ilon);
+
+      refr_index_air_agendaExecute(wss,
+                                   refr_index_air_field(0, ip, ilat, ilon),
+                                   refr_index_air_field(1, ip, ilat, ilon),
+                                   p_grid[ip],
+                                   t_field(ip, ilat, ilon),
+                                   rtp_vmr,
+                                   f_grid,
+                                   refr_index_air_agenda);
+    } catch (const std::exception& e) {
+#pragma omp critical(refr_index_air_fieldCalc_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg);
+}
+
 void complex_refr_indexWaterVisibleNIRHarvey98(GriddedField3& complex_refr_index,
                                 const Vector& data_f_grid,
                                 const Vector& data_t_grid,
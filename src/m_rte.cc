@@ -15,6 +15,7 @@
 #include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
+#include "disort.h"
 #include "geodetic.h"
 #include "gridded_fields.h"
 #include "jacobian.h"
@@ -115,6 +116,13 @@ void iyCalc(Workspace& ws,
   Tensor3 iy_transmittance(0, 0, 0);
   ArrayOfTensor3 diy_dx;
 
+  // Propagation matrices and layer optical properties are cached for the
+  // duration of this call
+  PropmatClearskyCache propmat_cache;
+  const PropmatClearskyCache::Activate propmat_active{&propmat_cache};
+  DisortLayerCache layer_cache;
+  const DisortLayerCache::Activate layer_active{&layer_cache};
+
   iy_main_agendaExecute(ws,
                         iy,
                         iy_aux,
@@ -931,6 +939,8 @@ void iyEmissionHybrid(Workspace& ws,
                        iy_transmittance,
                        rte_alonglos_v,
                        surface_props_data,
+                       0,
+                       0,
                        verbosity);
     return;
   }
@@ -1414,6 +1424,8 @@ void iyEmissionStandard(
     const Tensor3& iy_transmittance,
     const Numeric& rte_alonglos_v,
     const Tensor3& surface_props_data,
+    const Index& use_propmat_cache,
+    const Index& adjoint_jacobian,
     const Verbosity& verbosity) {
   //  Init Jacobian quantities?
   const Index j_analytical_do = jacobian_do ? do_analytical_jacobian<2>(jacobian_quantities) : 0;
@@ -1424,6 +1436,14 @@ void iyEmissionStandard(
   const Index np = ppath.np;
   const Index nq = j_analytical_do ? jacobian_quantities.nelem() : 0;
 
+  // In adjoint mode, layer derivatives are not stored but are applied
+  // directly after the radiance sweep
+  const bool do_adjoint = j_analytical_do and adjoint_jacobian;
+  const Index nq_fwd = do_adjoint ? 0 : nq;
+  ARTS_USER_ERROR_IF(do_adjoint and rt_integration_option == "second order",
+                     "Adjoint Jacobians are only supported for the first "
+                     "order integration.");
+
   // Radiative background index
   const Index rbi = ppath_what_background(ppath);
 
@@ -1475,7 +1495,7 @@ void iyEmissionStandard(
 
   ArrayOfRadiationVector lvl_rad(np, RadiationVector(nf, ns));
   ArrayOfArrayOfRadiationVector dlvl_rad(
-      np, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
+      np, ArrayOfRadiationVector(nq_fwd, RadiationVector(nf, ns)));
 
   ArrayOfRadiationVector src_rad(np, RadiationVector(nf, ns));
   ArrayOfArrayOfRadiationVector dsrc_rad(
@@ -1483,9 +1503,9 @@ void iyEmissionStandard(
 
   ArrayOfTransmissionMatrix lyr_tra(np, TransmissionMatrix(nf, ns));
   ArrayOfArrayOfTransmissionMatrix dlyr_tra_above(
-      np, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+      np, ArrayOfTransmissionMatrix(nq_fwd, TransmissionMatrix(nf, ns)));
   ArrayOfArrayOfTransmissionMatrix dlyr_tra_below(
-      np, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+      np, ArrayOfTransmissionMatrix(nq_fwd, TransmissionMatrix(nf, ns)));
 
   ArrayOfPropagationMatrix K(np, PropagationMatrix(nf, ns));
   ArrayOfArrayOfPropagationMatrix dK_dx(np);
@@ -1493,6 +1513,10 @@ void iyEmissionStandard(
   ArrayOfVector dr_below(np, Vector(nq, 0));
   ArrayOfVector dr_above(np, Vector(nq, 0));
 
+  // HSE variables
+  Index temperature_derivative_position = -1;
+  bool do_hse = false;
+
   if (np == 1 && rbi == 1) {  // i.e. ppath is totally outside the atmosphere:
     ppvar_p.resize(0);
     ppvar_t.resize(0);
@@ -1546,10 +1570,6 @@ void iyEmissionStandard(
     Vector dB_dT(temperature_jacobian ? nf : 0);
     ArrayOfStokesVector da_dx(nq), dS_dx(nq);
 
-    // HSE variables
-    Index temperature_derivative_position = -1;
-    bool do_hse = false;
-
     if (j_analytical_do) {
       for (Index ip = 0; ip < np; ip++) {
         dK_dx[ip].resize(nq);
@@ -1563,6 +1583,24 @@ void iyEmissionStandard(
           })
     }
 
+    // Without Doppler shifts, the frequency factors of the Planck function
+    // are the same for all points
+    bool fixed_f = true;
+    for (Index ip = 0; ip < np and fixed_f; ip++)
+      for (Index iv = 0; iv < nf and fixed_f; iv++)
+        fixed_f = ppvar_f(iv, ip) == f_grid[iv];
+    const PlanckFrequencyFactors planck_f =
+        fixed_f ? PlanckFrequencyFactors(f_grid) : PlanckFrequencyFactors();
+
+    // Propagation matrices are cached by yCalc and iyCalc, and otherwise
+    // only inside this call
+    PropmatClearskyCache own_propmat_cache;
+    PropmatClearskyCache* propmat_cache = nullptr;
+    if (use_propmat_cache) {
+      propmat_cache = PropmatClearskyCache::active();
+      if (not propmat_cache) propmat_cache = &own_propmat_cache;
+    }
+
     ArrayOfString fail_msg;
     bool do_abort = false;
 
@@ -1574,26 +1612,31 @@ void iyEmissionStandard(
     for (Index ip = 0; ip < np; ip++) {
       if (do_abort) continue;
       try {
-        get_stepwise_blackbody_radiation(
-            B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
+        if (fixed_f)
+          get_stepwise_blackbody_radiation(
+              B, dB_dT, planck_f, ppvar_t[ip], temperature_jacobian);
+        else
+          get_stepwise_blackbody_radiation(
+              B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
 
         Index lte;
-        get_stepwise_clearsky_propmat(wss,
-                                      K[ip],
-                                      S,
-                                      lte,
-                                      dK_dx[ip],
-                                      dS_dx,
-                                      propmat_clearsky_agenda,
-                                      jacobian_quantities,
-                                      Vector{ppvar_f(joker, ip)},
-                                      Vector{ppvar_mag(joker, ip)},
-                                      Vector{ppath.los(ip, joker)},
-                                      ppvar_nlte[ip],
-                                      Vector{ppvar_vmr(joker, ip)},
-                                      ppvar_t[ip],
-                                      ppvar_p[ip],
-                                      j_analytical_do);
+        get_stepwise_clearsky_propmat_cached(wss,
+                                             propmat_cache,
+                                             K[ip],
+                                             S,
+                                             lte,
+                                             dK_dx[ip],
+                                             dS_dx,
+                                             propmat_clearsky_agenda,
+                                             jacobian_quantities,
+                                             Vector{ppvar_f(joker, ip)},
+                                             Vector{ppvar_mag(joker, ip)},
+                                             Vector{ppath.los(ip, joker)},
+                                             ppvar_nlte[ip],
+                                             Vector{ppvar_vmr(joker, ip)},
+                                             ppvar_t[ip],
+                                             ppvar_p[ip],
+                                             j_analytical_do);
 
         if (j_analytical_do)
           adapt_stepwise_partial_derivatives(dK_dx[ip],
@@ -1775,6 +1818,78 @@ void iyEmissionStandard(
                         "1 and 2.");
   }
 
+  // Adjoint Jacobian: The derivatives of the layer transmission are
+  // recalculated layer by layer and are directly weighted with the
+  // cumulative transmission from the sensor. Layer ip contributes to
+  // level ip-1 (above) and level ip (below). Each level gets exactly two
+  // contributions, so layers of the same parity can be handled in parallel
+  // and the result equals the one of the forward sweep above.
+  if (do_adjoint) {
+    for (Index ip = 0; ip < np; ip++)
+      dlvl_rad[ip].resize(nq, RadiationVector(nf, ns));
+
+    TransmissionMatrix T(nf, ns);
+    ArrayOfTransmissionMatrix dT_above(nq, TransmissionMatrix(nf, ns));
+    ArrayOfTransmissionMatrix dT_below(nq, TransmissionMatrix(nf, ns));
+    RadiationVector ImJ(nf, ns);
+
+    ArrayOfString fail_msg;
+    bool do_abort = false;
+
+    for (Index ip0 = 1; ip0 < 3; ip0++) {
+#pragma omp parallel for if (!arts_omp_in_parallel()) \
+    firstprivate(T, dT_above, dT_below, ImJ)
+      for (Index ip = ip0; ip < np; ip += 2) {
+        if (do_abort) continue;
+        try {
+          const Numeric dr_dT_past =
+              do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip - 1]) : 0;
+          const Numeric dr_dT_this =
+              do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip]) : 0;
+          stepwise_transmission(T,
+                                dT_above,
+                                dT_below,
+                                K[ip - 1],
+                                K[ip],
+                                dK_dx[ip - 1],
+                                dK_dx[ip],
+                                ppath.lstep[ip - 1],
+                                dr_dT_past,
+                                dr_dT_this,
+                                temperature_derivative_position);
+
+          ImJ = lvl_rad[ip];
+          ImJ.rem_avg(src_rad[ip - 1], src_rad[ip]);
+          for (Index iq = 0; iq < nq; iq++) {
+            dlvl_rad[ip - 1][iq].addDerivEmission(tot_tra[ip - 1],
+                                                  dT_above[iq],
+                                                  lyr_tra[ip],
+                                                  ImJ,
+                                                  dsrc_rad[ip - 1][iq]);
+            dlvl_rad[ip][iq].addDerivEmission(tot_tra[ip - 1],
+                                              dT_below[iq],
+                                              lyr_tra[ip],
+                                              ImJ,
+                                              dsrc_rad[ip][iq]);
+          }
+        } catch (const std::runtime_error& e) {
+          ostringstream os;
+          os << "Runtime-error in adjoint Jacobian calculation at index " << ip
+             << ": \n";
+          os << e.what();
+#pragma omp critical(iyEmissionStandard_adjoint)
+          {
+            do_abort = true;
+            fail_msg.push_back(os.str());
+          }
+        }
+      }
+    }
+
+    ARTS_USER_ERROR_IF (do_abort,
+      "Error messages from failed cases:\n", fail_msg)
+  }
+
   // Copy back to ARTS external style
   iy = lvl_rad[0];
   for (Index ip = 0; ip < lvl_rad.nelem(); ip++) {
@@ -2480,6 +2595,8 @@ void iyMC(Workspace& ws,
                   mc_taustep_limit,
                   1,
                   t_interp_order,
+                  0,
+                  0,
                   verbosity);
 
         ARTS_ASSERT(y.nelem() == stokes_dim);
@@ -2615,12 +2732,18 @@ void yCalc(Workspace& ws,
   const Index nlos = mblock_dlos.nrows();
   const Index n1y = sensor_response.nrows();
   const Index nmblock = sensor_pos.nrows();
-  const Index niyb = nf * nlos * stokes_dim;
 
   //---------------------------------------------------------------------------
   // Allocations and resizing
   //---------------------------------------------------------------------------
 
+  // Propagation matrices and layer optical properties are cached for the
+  // duration of this call, see *iyEmissionStandard*
+  PropmatClearskyCache propmat_cache;
+  const PropmatClearskyCache::Activate propmat_active{&propmat_cache};
+  DisortLayerCache layer_cache;
+  const DisortLayerCache::Activate layer_active{&layer_cache};
+
   // Resize *y* and *y_XXX*
   //
   y.resize(nmblock * n1y);
@@ -2670,6 +2793,9 @@ void yCalc(Workspace& ws,
       // Skip remaining iterations if an error occurred
       if (failed) continue;
 
+      const PropmatClearskyCache::Activate propmat_thread{&propmat_cache};
+      const DisortLayerCache::Activate layer_thread{&layer_cache};
+
       yCalc_mblock_loop_body(failed,
                              fail_msg,
                              iyb_aux_array,
@@ -2773,11 +2899,11 @@ void yCalc(Workspace& ws,
         for (Index i = 0; i < n1y; i++) {
           const Index row = row0 + i;
           y_aux[q][row] = 0;
-          for (Index j = 0; j < niyb; j++) {
+          // Only the stored elements of sensor_response contribute
+          sensor_response.for_each_in_row(i, [&](Index j, Numeric h) {
             y_aux[q][row] +=
-                pow(sensor_response(i, j) * iyb_aux_array[mblock_index][q][j],
-                    (Numeric)2.0);
-          }
+                pow(h * iyb_aux_array[mblock_index][q][j], (Numeric)2.0);
+          });
           y_aux[q][row] = sqrt(y_aux[q][row]);
         }
       } else {
@@ -24,6 +24,7 @@
 #include "arts.h"
 #include "arts_constants.h"
 #include "arts_conversions.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "gridded_fields.h"
@@ -2346,10 +2347,18 @@ void sensor_responseMultiMixerBackend(
   if (error_found) throw runtime_error(os.str());
 
   // Variables for data to be appended
-  Array<Sparse> sr;
-  ArrayOfVector srfgrid;
+  Array<Sparse> sr(nlo);
+  ArrayOfVector srfgrid(nlo);
   ArrayOfIndex cumsumf(nlo + 1, 0);
+  ArrayOfString fail_msg(nlo);
 
+  // The receiver chains are independent, and are handled in parallel.
+  // The methods building a chain report to out3, and the chains are then
+  // built in order to keep that output readable.
+  CREATE_OUT3;
+  const bool chains_in_parallel = !out3.sufficient_priority();
+#pragma omp parallel for if (!arts_omp_in_parallel() && nlo > 1 && \
+                             chains_in_parallel)
   for (Index ilo = 0; ilo < nlo; ilo++) {
     // Copies of variables that will be changed, but must be
     // restored for next loop
@@ -2387,19 +2396,25 @@ void sensor_responseMultiMixerBackend(
                              backend_channel_response_multi[ilo],
                              sensor_norm,
                              verbosity);
-    } catch (const runtime_error& e) {
+    } catch (const std::exception& e) {
       ostringstream os2;
       os2 << "Error when dealing with receiver/mixer chain (1-based index) "
           << ilo + 1 << ":\n"
           << e.what();
-      throw runtime_error(os2.str());
+      fail_msg[ilo] = os2.str();
+      continue;
     }
 
     // Store in temporary arrays
-    sr.push_back(sr1);
-    srfgrid.push_back(srfgrid1);
-    //
-    cumsumf[ilo + 1] = cumsumf[ilo] + srfgrid1.nelem();
+    sr[ilo] = std::move(sr1);
+    srfgrid[ilo] = std::move(srfgrid1);
+  }
+
+  // Report the first failing chain, as done when the chains were handled
+  // in sequence
+  for (Index ilo = 0; ilo < nlo; ilo++) {
+    if (fail_msg[ilo].nelem()) throw runtime_error(fail_msg[ilo]);
+    cumsumf[ilo + 1] = cumsumf[ilo] + srfgrid[ilo].nelem();
   }
 
   // Append data to create sensor_response_f_grid
@@ -2421,7 +2436,17 @@ void sensor_responseMultiMixerBackend(
   //
   sensor_response.resize(nlos * nfpolnew, ncols);
   //
-  Vector dummy(ncols, 0.0);
+  // The non-zero elements of each chain are moved to their new rows, and
+  // all are inserted in one go
+  //
+  Index nnz = 0;
+  for (Index ilo = 0; ilo < nlo; ilo++) nnz += sr[ilo].nnz();
+  //
+  ArrayOfIndex rowind, colind;
+  rowind.reserve(nnz);
+  colind.reserve(nnz);
+  Vector data(nnz);
+  nnz = 0;
   //
   for (Index ilo = 0; ilo < nlo; ilo++) {
     const Index nfpolthis = (cumsumf[ilo + 1] - cumsumf[ilo]) * npolnew;
@@ -2429,18 +2454,23 @@ void sensor_responseMultiMixerBackend(
     ARTS_ASSERT(sr[ilo].nrows() == nlos * nfpolthis);
     ARTS_ASSERT(sr[ilo].ncols() == ncols);
 
-    for (Index ilos = 0; ilos < nlos; ilos++) {
-      for (Index i = 0; i < nfpolthis; i++) {
-        // "Poor mans" transfer of a row from one sparse to another
-        for (Index ic = 0; ic < ncols; ic++) {
-          dummy[ic] = sr[ilo](ilos * nfpolthis + i, ic);
-        }
+    Vector values;
+    ArrayOfIndex rows, cols;
+    sr[ilo].list_elements(values, rows, cols);
 
-        sensor_response.insert_row(ilos * nfpolnew + cumsumf[ilo] * npolnew + i,
-                                   dummy);
-      }
+    for (Index j = 0; j < values.nelem(); j++) {
+      // Zeros are left out, as done by insert_row
+      if (values[j] == 0) continue;
+
+      const Index ilos = rows[j] / nfpolthis;
+      const Index i = rows[j] % nfpolthis;
+      rowind.push_back(ilos * nfpolnew + cumsumf[ilo] * npolnew + i);
+      colind.push_back(cols[j]);
+      data[nnz++] = values[j];
     }
   }
+  //
+  sensor_response.insert_elements(nnz, rowind, colind, data);
 
   // Set aux variables
   sensor_aux_vectors(sensor_response_f,
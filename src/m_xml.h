@@ -10,15 +10,15 @@
 #ifndef m_xml_h
 #define m_xml_h
 
-#ifdef ENABLE_MPI
-#include "mpi.h"
-#endif
-
 #include "agenda_class.h"
 #include "exceptions.h"
 #include "workspace_ng.h"
 #include "xml_io.h"
 
+#ifdef ENABLE_MPI
+#include "mpi.h"
+#endif
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 template <typename T>
 void ReadXML(  // WS Generic Output:
@@ -1341,6 +1341,89 @@ constexpr auto interp(const matpack::strict_rank_matpack_type<N> auto &field,
   return out;
 }
 
+namespace internal {
+/** Explicit loops of reinterp with re-usable weights for up to 3 dimensions
+ *
+ * The terms are summed in the same order as by interp, so the result is
+ * identical, but the generic position and index handling of interp is
+ * avoided for every output value
+ */
+template <list_of_lagrange_type L0>
+constexpr void reinterp_loops(auto &&out, const auto &field, const auto &iw,
+                              const L0 &l0) {
+  using T = matpack::matpack_value_type<decltype(field)>;
+  const auto shp = matpack::mdshape(field);
+  const auto osh = matpack::mdshape(out);
+
+  for (Index i0 = 0; i0 < osh[0]; i0++) {
+    const auto &a = l0[i0];
+    const auto na = static_cast<Index>(a.size());
+    T x{0};
+    for (Index k0 = 0; k0 < na; k0++)
+      x += iw(i0, k0) * field(a.index_pos(k0, shp[0]));
+    out(i0) = x;
+  }
+}
+
+template <list_of_lagrange_type L0, list_of_lagrange_type L1>
+constexpr void reinterp_loops(auto &&out, const auto &field, const auto &iw,
+                              const L0 &l0, const L1 &l1) {
+  using T = matpack::matpack_value_type<decltype(field)>;
+  const auto shp = matpack::mdshape(field);
+  const auto osh = matpack::mdshape(out);
+
+  for (Index i0 = 0; i0 < osh[0]; i0++) {
+    const auto &a = l0[i0];
+    const auto na = static_cast<Index>(a.size());
+    for (Index i1 = 0; i1 < osh[1]; i1++) {
+      const auto &b = l1[i1];
+      const auto nb = static_cast<Index>(b.size());
+      T x{0};
+      for (Index k0 = 0; k0 < na; k0++) {
+        const Index j0 = a.index_pos(k0, shp[0]);
+        for (Index k1 = 0; k1 < nb; k1++)
+          x += iw(i0, i1, k0, k1) * field(j0, b.index_pos(k1, shp[1]));
+      }
+      out(i0, i1) = x;
+    }
+  }
+}
+
+template <list_of_lagrange_type L0,
+          list_of_lagrange_type L1,
+          list_of_lagrange_type L2>
+constexpr void reinterp_loops(auto &&out, const auto &field, const auto &iw,
+                              const L0 &l0, const L1 &l1, const L2 &l2) {
+  using T = matpack::matpack_value_type<decltype(field)>;
+  const auto shp = matpack::mdshape(field);
+  const auto osh = matpack::mdshape(out);
+
+  for (Index i0 = 0; i0 < osh[0]; i0++) {
+    const auto &a = l0[i0];
+    const auto na = static_cast<Index>(a.size());
+    for (Index i1 = 0; i1 < osh[1]; i1++) {
+      const auto &b = l1[i1];
+      const auto nb = static_cast<Index>(b.size());
+      for (Index i2 = 0; i2 < osh[2]; i2++) {
+        const auto &c = l2[i2];
+        const auto nc = static_cast<Index>(c.size());
+        T x{0};
+        for (Index k0 = 0; k0 < na; k0++) {
+          const Index j0 = a.index_pos(k0, shp[0]);
+          for (Index k1 = 0; k1 < nb; k1++) {
+            const Index j1 = b.index_pos(k1, shp[1]);
+            for (Index k2 = 0; k2 < nc; k2++)
+              x += iw(i0, i1, i2, k0, k1, k2) *
+                   field(j0, j1, c.index_pos(k2, shp[2]));
+          }
+        }
+        out(i0, i1, i2) = x;
+      }
+    }
+  }
+}
+}  // namespace internal
+
 /** Reinterpolates a field as another field with re-usable weights
  *
  *  This is done by calling interp for all the combinations of the inputs
@@ -1358,17 +1441,21 @@ reinterp(matpack::strict_rank_matpack_type<N> auto &&out,
          const matpack::strict_rank_matpack_type<N> auto &field,
          const matpack::ranked_matpack_type<Numeric, 2 * N> auto &iw_field,
          const lags &...list_lag) {
-  for (matpack::flat_shape_pos<N> pos{out.shape()};
-       pos.pos.front() < pos.shp.front(); ++pos) {
-    std::apply(
-        [&](auto... ind) {
-          out(ind...) =
-              interp(field,
-                     std::apply(iw_field, std::tuple_cat(std::array{ind...},
-                                                         matpack::jokers<N>())),
-                     list_lag[ind]...);
-        },
-        pos.pos);
+  if constexpr (N <= 3) {
+    internal::reinterp_loops(out, field, iw_field, list_lag...);
+  } else {
+    for (matpack::flat_shape_pos<N> pos{out.shape()};
+         pos.pos.front() < pos.shp.front(); ++pos) {
+      std::apply(
+          [&](auto... ind) {
+            out(ind...) = interp(
+                field,
+                std::apply(iw_field, std::tuple_cat(std::array{ind...},
+                                                    matpack::jokers<N>())),
+                list_lag[ind]...);
+          },
+          pos.pos);
+    }
   }
 }
 
@@ -1392,6 +1479,60 @@ constexpr auto reinterp(const matpack::strict_rank_matpack_type<N> auto &field,
   return out;
 }
 
+/** Reinterpolates the leading dimension of a field with re-usable weights
+ *
+ * The other dimensions are kept, so out must have the shape of field except
+ * for the leading dimension. The weights of an output position are applied
+ * to whole hyperplanes of the field. The inner loop thus runs over the
+ * trailing dimensions, and is contiguous for exhaustive fields, instead of
+ * over the interpolation order.
+ *
+ * The result is identical to calling reinterp for each position of the
+ * trailing dimensions.
+ *
+ * @param[inout] out A writable output-field of the same rank as field
+ * @param[in] field A field value
+ * @param[in] iw_field Interpolation weights as from interpweights(list_lag)
+ * @param[in] list_lag A list of Lagrange values for the leading dimension
+ */
+template <list_of_lagrange_type lags>
+constexpr void
+reinterp_leading_dim(matpack::any_matpack_type auto &&out,
+                     const matpack::any_matpack_type auto &field,
+                     const matpack::ranked_matpack_type<Numeric, 2> auto &iw_field,
+                     const lags &list_lag) {
+  constexpr auto N = matpack::rank<decltype(field)>();
+  static_assert(N == matpack::rank<decltype(out)>(),
+                "The field and out must have the same rank");
+
+  if constexpr (N == 1) {
+    internal::reinterp_loops(out, field, iw_field, list_lag);
+  } else {
+    const Index maxsize = matpack::mdshape(field)[0];
+    const Index n = matpack::mdshape(out)[0];
+
+    for (Index i = 0; i < n; i++) {
+      const auto &lag = list_lag[i];
+      auto o = std::apply(
+          out, std::tuple_cat(std::array{i}, matpack::jokers<N - 1>()));
+      std::fill(o.elem_begin(), o.elem_end(), 0);
+
+      for (Index k = 0; k < static_cast<Index>(lag.size()); k++) {
+        const Numeric w = iw_field(i, k);
+        const auto f = std::apply(
+            field,
+            std::tuple_cat(std::array{lag.index_pos(k, maxsize)},
+                           matpack::jokers<N - 1>()));
+        std::transform(o.elem_begin(),
+                       o.elem_end(),
+                       f.elem_begin(),
+                       o.elem_begin(),
+                       [w](auto x, auto y) { return x + w * y; });
+      }
+    }
+  }
+}
+
 /** Interpolate a single output value
  * 
  * @tparam lags... Several Lagrange types
@@ -28,6 +28,7 @@
 #include <cmath>
 #include <iostream>  // For debugging.
 #include <iterator>
+#include <limits>
 #include <set>
 #include <vector>
 
@@ -248,11 +249,7 @@ Sparse& Sparse::operator/=(Numeric x) {
 void Sparse::list_elements(Vector& values,
                            ArrayOfIndex& row_indices,
                            ArrayOfIndex& column_indices) const {
-  Index m, n;
-  m = nrows();
-  n = ncols();
-  Matrix A(m, n);
-  A = 0.0;
+  const Index m = nrows();
 
   values.resize(nnz());
   row_indices.resize(nnz());
@@ -270,6 +267,26 @@ void Sparse::list_elements(Vector& values,
   }
 }
 
+Index Sparse::row_argmax(Index r) const {
+  Index jmax = -1;
+  Numeric rmax = -std::numeric_limits<Numeric>::infinity();
+  Index jnext = 0;
+  for_each_in_row(r, [&](Index j, Numeric v) {
+    // Of the zeros not stored, only the first one of a gap can be the max
+    if (j > jnext && 0 > rmax) {
+      rmax = 0;
+      jmax = jnext;
+    }
+    if (v > rmax) {
+      rmax = v;
+      jmax = j;
+    }
+    jnext = j + 1;
+  });
+  if (jnext < ncols() && 0 > rmax) jmax = jnext;
+  return jmax;
+}
+
 Numeric* Sparse::get_element_pointer() { return matrix.valuePtr(); }
 int* Sparse::get_column_index_pointer() { return matrix.innerIndexPtr(); }
 int* Sparse::get_row_start_pointer() { return matrix.outerIndexPtr(); }
@@ -483,6 +500,24 @@ void mult(MatrixView A, const Sparse& B, const ConstMatrixView& C) {
   typedef Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic> Stride;
   typedef Eigen::Map<EigenMatrix, 0, Stride> MatrixMap;
 
+  // With contiguous rows, as for a Matrix or a block of it, Eigen can use
+  // vectorised row operations. The result is the same as below.
+  if (A.stride(1) == 1 && C.stride(1) == 1) {
+    typedef Eigen::Map<EigenMatrix, 0, Eigen::OuterStride<>> RowMatrixMap;
+
+    RowMatrixMap C_map(C.unsafe_data_handle(),
+                       C.nrows(),
+                       C.ncols(),
+                       Eigen::OuterStride<>(C.stride(0)));
+    RowMatrixMap A_map(A.unsafe_data_handle(),
+                       A.nrows(),
+                       A.ncols(),
+                       Eigen::OuterStride<>(A.stride(0)));
+
+    A_map = B.matrix * C_map;
+    return;
+  }
+
   Index row_stride, column_stride;
   row_stride = C.stride(0);
   column_stride = C.stride(1);
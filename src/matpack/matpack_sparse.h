@@ -115,6 +115,33 @@ struct Sparse {
                      ArrayOfIndex& row_indices,
                      ArrayOfIndex& column_indices) const;
 
+  /** Visit the stored elements of a row
+     *
+     * Calls f(column, value) for each stored element of row r, in
+     * increasing column order. Elements not stored are zero.
+     *
+     * @param r The row index.
+     * @param f Callable taking (Index, Numeric).
+     */
+  template <typename F>
+  void for_each_in_row(Index r, F&& f) const {
+    for (Eigen::SparseMatrix<Numeric, Eigen::RowMajor>::InnerIterator it(
+             matrix, static_cast<int>(r));
+         it;
+         ++it)
+      f(static_cast<Index>(it.col()), it.value());
+  }
+
+  /** Column of the max value of a row
+     *
+     * Elements not stored count as zero. If several columns hold the max
+     * value, the first one is returned.
+     *
+     * @param r The row index.
+     * @return The column index, or -1 if the matrix has no columns.
+     */
+  [[nodiscard]] Index row_argmax(Index r) const;
+
   Numeric* get_element_pointer();
   int* get_column_index_pointer();
   int* get_row_start_pointer();
@@ -4475,7 +4475,21 @@ R"(
           "      The atmospheric dimensionality *atmosphere_dim* can be\n"
           "      either 1 or 3. To these dimensions the method adapts\n"
           "      automatically. 2D scattering calculations are not\n"
-          "      supported.\n"),
+          "      supported.\n"
+          "\n"
+          "The plain fixed-point iteration can be accelerated in two ways.\n"
+          "Ng acceleration is selected by ``accelerated``, and is applied every\n"
+          "fourth iteration. Anderson acceleration is selected by setting\n"
+          "``anderson_depth`` to the number of previous iterations to consider\n"
+          "(typically 3-10), and is applied in every iteration. The new field\n"
+          "is then the combination of the latest sweeps that minimises the\n"
+          "difference between sweep input and output. This can reduce the\n"
+          "number of iterations strongly for optically thick clouds, at the\n"
+          "cost of storing 2*(``anderson_depth``+1) copies of the field.\n"
+          "The two acceleration methods can not be combined.\n"
+          "\n"
+          "The number of iterations and the time used are reported at\n"
+          "verbosity level 2.\n"),
       AUTHORS("Claudia Emde, Jakob Doerr"),
       OUT("cloudbox_field_mono"),
       GOUT(),
@@ -4485,11 +4499,12 @@ R"(
          "doit_scat_field_agenda",
          "doit_rte_agenda",
          "doit_conv_test_agenda"),
-      GIN("accelerated"),
-      GIN_TYPE("Index"),
-      GIN_DEFAULT("0"),
+      GIN("accelerated", "anderson_depth"),
+      GIN_TYPE("Index", "Index"),
+      GIN_DEFAULT("0", "0"),
       GIN_DESC(
-          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)")));
+          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)",
+          "History depth of Anderson acceleration (0 = no Anderson acceleration)")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("cloudbox_fieldCrop"),
@@ -5710,7 +5725,24 @@ R"(
           "\n"
           "- ``\"Layer optical thickness\"``: Matrix [f_grid, size of p_grid - 1] layer optical thickness.\n"
           "- ``\"Single scattering albedo\"``: Matrix [f_grid, size of p_grid - 1] layer single\" scattering albedo.\n"
-          "- ``\"Direct beam\"``: Matrix [f_grid, p_grid]. Attenuated direct at level. Zero, if no sun is present \n"),
+          "- ``\"Direct beam\"``: Matrix [f_grid, p_grid]. Attenuated direct at level. Zero, if no sun is present \n"
+          "\n"
+          "If ``layer_cache_tolerance`` is zero or positive, the optical\n"
+          "depth per unit length, single scattering albedo and Legendre\n"
+          "moments of each layer are stored and reused in later calls for\n"
+          "layers bounded by the same atmospheric state (pressure,\n"
+          "temperature, VMRs and PNDs at the two levels). This saves time\n"
+          "when the method is used inside *iy_independent_beam_approx_agenda*,\n"
+          "as neighbouring pencil beams give almost identical columns. A\n"
+          "value of 0 demands exact agreement, and gives the same result as\n"
+          "without the cache. With a positive value, the optical properties\n"
+          "of all layers are calculated for the states rounded to the\n"
+          "relative precision given by ``layer_cache_tolerance``, and the\n"
+          "result does not depend on the order in which layers are handled.\n"
+          "The stored data are kept for the duration of a *yCalc* or *iyCalc*,\n"
+          "and are otherwise only used inside a single call of this method.\n"
+          "Absorption and scattering data must not be changed inside *yCalc*\n"
+          "when this option is used.\n"),
       AUTHORS("Claudia Emde, Jana Mendrok", "Manfred Brath"),
       OUT("cloudbox_field","disort_aux"),
       GOUT(),
@@ -5745,9 +5777,9 @@ R"(
          "gas_scattering_do",
          "suns_do",
          "disort_aux_vars"),
-      GIN("nstreams", "Npfct", "only_tro", "quiet", "emission","intensity_correction"),
-      GIN_TYPE("Index", "Index", "Index", "Index", "Index", "Index"),
-      GIN_DEFAULT("8", "181", "0", "0", "1", "1"),
+      GIN("nstreams", "Npfct", "only_tro", "quiet", "emission","intensity_correction", "layer_cache_tolerance"),
+      GIN_TYPE("Index", "Index", "Index", "Index", "Index", "Index", "Numeric"),
+      GIN_DEFAULT("8", "181", "0", "0", "1", "1", "-1"),
       GIN_DESC("Number of polar angle directions (streams) in DISORT"
                " solution (must be an even number).",
                "Number of angular grid points to calculate bulk phase"
@@ -5762,7 +5794,9 @@ R"(
                " is needed",
                "Enables intensity correction. Importantant for low number of"
                " streams. Set to zero, if problems encounter or using a high number"
-               " of streams (>30)")));
+               " of streams (>30)",
+               "Relative tolerance for reusing layer optical properties,"
+               " see above. A negative value deactivates the reuse.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("cloudbox_fieldDisortWithARTSSurface"),
@@ -5782,7 +5816,9 @@ R"(
           "Valid choices for auxiliary data are:\n\n"
           "- ``\"Layer optical thickness\"``: Matrix [f_grid, size of p_grid - 1] layer optical thickness.\n"
           "- ``\"Single scattering albedo\"``: Matrix [f_grid, size of p_grid - 1] layer single\"scattering albedo.\n"
-          "- ``\"Direct beam\"``: Matrix [f_grid, p_grid]. Attenuated direct at level.Zero, if no sun is present \n"),
+          "- ``\"Direct beam\"``: Matrix [f_grid, p_grid]. Attenuated direct at level.Zero, if no sun is present \n"
+          "\n"
+          "The GIN ``layer_cache_tolerance`` works as for *cloudbox_fieldDisort*.\n"),
       AUTHORS("Claudia Emde, Jana Mendrok", "Manfred Brath"),
       OUT("cloudbox_field","disort_aux"),
       GOUT(),
@@ -5816,9 +5852,9 @@ R"(
          "gas_scattering_do",
          "suns_do",
          "disort_aux_vars"),
-      GIN("nstreams", "Npfct", "only_tro", "quiet", "emission", "intensity_correction", "inc_angle"),
-      GIN_TYPE("Index", "Index", "Index", "Index", "Index", "Index","Numeric"),
-      GIN_DEFAULT("8", "181", "0", "0", "1", "1", "-1"),
+      GIN("nstreams", "Npfct", "only_tro", "quiet", "emission", "intensity_correction", "inc_angle", "layer_cache_tolerance"),
+      GIN_TYPE("Index", "Index", "Index", "Index", "Index", "Index","Numeric", "Numeric"),
+      GIN_DEFAULT("8", "181", "0", "0", "1", "1", "-1", "-1"),
       GIN_DESC("Number of polar angle directions (streams) in DISORT "
                " solution (must be an even number).",
                "Number of angular grid points to calculate bulk phase"
@@ -5834,7 +5870,9 @@ R"(
                "Enables intensity correction. Importantant for low number of"
                " streams. Set to zero, if problems encounter or using a high number"
                " of streams (>30)",
-               "Incidence angle, see above.")));
+               "Incidence angle, see above.",
+               "Relative tolerance for reusing layer optical properties,"
+               " see above. A negative value deactivates the reuse.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("spectral_radiance_fieldDisortClearsky"),
@@ -5970,6 +6008,67 @@ R"(
                " streams. Set to zero, if problems encounter or using a high number "
                " of streams (>30)")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("spectral_irradiance_fieldTwoStream"),
+      DESCRIPTION(
+          "A fast two-stream solver for flux (irradiance) calculations.\n"
+          "\n"
+          "The method is an approximate alternative to\n"
+          "*spectral_irradiance_fieldDisort*, with the same input and the same\n"
+          "assumptions: a scalar 1D plane-parallel atmosphere, totally randomly\n"
+          "oriented particles, no refraction, and Lambertian surface reflection.\n"
+          "The cloudbox is set to cover the complete atmosphere.\n"
+          "\n"
+          "The gas and particle optical properties are derived as for DISORT.\n"
+          "Of the bulk phase function only the asymmetry parameter is used,\n"
+          "and delta-Eddington scaling is applied. The layer reflectances and\n"
+          "transmittances follow Meador and Weaver (1980), and the fluxes are\n"
+          "obtained by the adding method. The solution is done for all\n"
+          "frequencies at once. If a sun is present, the PIFM coefficients of\n"
+          "Zdunkowski et al. (1980) are used, otherwise a diffusivity factor\n"
+          "of 1.66.\n"
+          "\n"
+          "The accuracy is typically a few percent for the fluxes, which is\n"
+          "often sufficient for broadband heating rates. Use\n"
+          "*spectral_irradiance_fieldDisort* when higher accuracy is needed.\n"),
+      AUTHORS("agent"),
+      OUT("spectral_irradiance_field"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("atmfields_checked",
+         "atmgeom_checked",
+         "scat_data_checked",
+         "propmat_clearsky_agenda",
+         "gas_scattering_agenda",
+         "atmosphere_dim",
+         "pnd_field",
+         "t_field",
+         "z_field",
+         "vmr_field",
+         "p_grid",
+         "lat_true",
+         "lon_true",
+         "refellipsoid",
+         "scat_data",
+         "suns",
+         "f_grid",
+         "stokes_dim",
+         "z_surface",
+         "surface_skin_t",
+         "surface_scalar_reflectivity",
+         "gas_scattering_do",
+         "suns_do"),
+      GIN("Npfct", "emission"),
+      GIN_TYPE("Index", "Index"),
+      GIN_DEFAULT("181", "1"),
+      GIN_DESC("Number of angular grid points to calculate bulk phase"
+               " function on (and derive the asymmetry parameter from). If <0,"
+               " the finest za_grid from scat_data will be used.",
+               "Enables blackbody emission. Set to zero, if no "
+               " Emission e. g. like in visible regime for earth"
+               " is needed")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("DOBatchCalc"),
       DESCRIPTION(
@@ -6001,7 +6100,31 @@ R"(
           "Beside the *dobatch_calc_agenda*, the WSVs *ybatch_start*\n"
           "and *ybatch_n* must be set before calling this method.\n"
           "\n"
-          "The input variable *ybatch_start* is set to a default of zero.\n"),
+          "The input variable *ybatch_start* is set to a default of zero.\n"
+          "\n"
+          "The jobs are distributed over the available threads. With ``cost``\n"
+          "an estimate of the relative cost of each job can be given, the most\n"
+          "expensive jobs are then started first, which avoids that a few long\n"
+          "jobs run alone at the end of the batch. By default one job is run\n"
+          "per thread. Batches of few but large jobs can instead run fewer\n"
+          "jobs at the same time, with ``max_parallel_jobs``, and let each job\n"
+          "use several threads, set by ``nthreads_per_job``. Timing and failure\n"
+          "statistics of the jobs are given on out1 at the end.\n"
+          "\n"
+          "If ARTS is compiled with MPI support and started as several MPI\n"
+          "processes (e.g. mpirun -np 4 arts ...), the jobs are instead\n"
+          "distributed over the processes. All processes run the same\n"
+          "controlfile, so each sets up its own workspace. Rank 0 hands out the\n"
+          "jobs as the processes become free and collects the results. Each\n"
+          "process, rank 0 included, calculates one job at a time, with\n"
+          "``nthreads_per_job`` or all its threads. At the end, all processes\n"
+          "hold the same output.\n"
+          "\n"
+          "With ``checkpoint`` set, each finished job is saved as binary XML\n"
+          "files named <checkpoint>.<ybatch_index>.<variable>.xml, where\n"
+          "<variable> is the name of each of the four output variables. Jobs\n"
+          "found on disk are read instead of calculated, so an interrupted\n"
+          "batch is resumed by just rerunning it with the same settings.\n"),
       AUTHORS("Oliver Lemke"),
       OUT("dobatch_cloudbox_field",
           "dobatch_radiance_field",
@@ -6011,14 +6134,26 @@ R"(
       GOUT_TYPE(),
       GOUT_DESC(),
       IN("ybatch_start", "ybatch_n", "dobatch_calc_agenda"),
-      GIN("robust"),
-      GIN_TYPE("Index"),
-      GIN_DEFAULT("0"),
+      GIN("robust",
+          "checkpoint",
+          "cost",
+          "max_parallel_jobs",
+          "nthreads_per_job"),
+      GIN_TYPE("Index", "String", "Vector", "Index", "Index"),
+      GIN_DEFAULT("0", "", "[]", "0", "0"),
       GIN_DESC("A flag with value 1 or 0. If set to one, the batch "
                "calculation will continue, even if individual jobs fail. In "
                "that case, a warning message is written to screen and file "
                "(out1 output stream), and the output array entry for the "
-               "failed job in the output fields is left empty.")));
+               "failed job in the output fields is left empty.",
+               "If not empty, finished jobs are saved to files with this "
+               "basename, and jobs already saved are not calculated again.",
+               "Estimated relative cost of each job, one element per job. "
+               "Expensive jobs are started first. Not used if empty.",
+               "Maximum number of jobs calculated at the same time. 0 gives "
+               "one job per thread.",
+               "Number of threads used inside each job. 0 shares all threads "
+               "between the jobs calculated at the same time.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("DOAngularGridsSet"),
@@ -6988,6 +7123,57 @@ R"(
       GIN_DEFAULT(NODEF),
       GIN_DESC("Kayser wavenumber [cm^-1]")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("f_gridCorrelatedK"),
+      DESCRIPTION(
+          "Sets *f_grid* to representative frequencies of a k-distribution.\n"
+          "\n"
+          "The method is intended for broadband flux and heating rate\n"
+          "calculations, where a dense monochromatic frequency grid is\n"
+          "too costly. The gas absorption is calculated line-by-line for\n"
+          "the frequencies of ``f_grid_lbl`` by *propmat_clearsky_agenda*,\n"
+          "and the zenith optical depth of the atmospheric column is derived.\n"
+          "Inside each band, defined by ``band_edges``, the frequencies are\n"
+          "sorted by optical depth and the cumulative spectral weight (g)\n"
+          "is split into ``n_gpoints`` equally wide g-intervals. For each\n"
+          "g-interval one representative frequency is selected, the one\n"
+          "at the weighted median optical depth of the interval.\n"
+          "\n"
+          "The output *f_grid* holds the representative frequencies, sorted.\n"
+          "``f_grid_weights`` holds the matching spectral weights [Hz]. These\n"
+          "are the summed trapezoidal weights of the ``f_grid_lbl`` frequencies\n"
+          "that fall inside each g-interval. The flux solvers can then be run\n"
+          "as usual, e.g. *spectral_irradiance_fieldDisort*, and the result is\n"
+          "integrated by passing ``f_grid_weights`` to\n"
+          "*RadiationFieldSpectralIntegrate*. If ``n_gpoints`` is not smaller\n"
+          "than the number of ``f_grid_lbl`` frequencies in any band, the\n"
+          "monochromatic trapezoidal integration is reproduced exactly, which\n"
+          "can be used to validate a reduced setup.\n"
+          "\n"
+          "The correlated-k assumption is that the spectral ordering of the\n"
+          "absorption is the same at all levels. Frequencies of ``f_grid_lbl``\n"
+          "outside of the bands are ignored. The band edges must be\n"
+          "increasing, and the upper edge of the last band is inclusive.\n"
+          "\n"
+          "Only 1D atmospheres are handled.\n"),
+      AUTHORS("agent"),
+      OUT("f_grid"),
+      GOUT("f_grid_weights"),
+      GOUT_TYPE("Vector"),
+      GOUT_DESC("Spectral integration weights of *f_grid* [Hz]."),
+      IN("atmosphere_dim",
+         "p_grid",
+         "z_field",
+         "t_field",
+         "vmr_field",
+         "propmat_clearsky_agenda"),
+      GIN("f_grid_lbl", "band_edges", "n_gpoints"),
+      GIN_TYPE("Vector", "Vector", "Index"),
+      GIN_DEFAULT(NODEF, NODEF, "16"),
+      GIN_DESC("Dense monochromatic frequency grid [Hz].",
+               "Edges of the bands [Hz].",
+               "Number of g-points per band.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("f_gridFromAbsorptionLines"),
       DESCRIPTION("Sets *f_grid* to a grid relative to *abs_lines_per_species*\n"
@@ -7587,6 +7773,31 @@ R"(
       GIN_DEFAULT(NODEF),
       GIN_DESC("Raw input gridded field.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("GriddedFieldLatLonPRegrid"),
+      DESCRIPTION(
+          "Interpolates all input fields to *lat_true*, *lon_true* and *p_grid*.\n"
+          "\n"
+          "Gives the same result as *GriddedFieldLatLonRegrid* followed by\n"
+          "*GriddedFieldPRegrid*, but grid positions and interpolation weights\n"
+          "are calculated only once for fields sharing the same raw grids, and\n"
+          "all fields are interpolated in a single parallel pass.\n"
+          "\n"
+          "See *GriddedFieldPRegrid* for the meaning of zero-padding.\n"
+          "input and output fields can be the same variable.\n"),
+      AUTHORS("agent"),
+      OUT(),
+      GOUT("output"),
+      GOUT_TYPE("ArrayOfGriddedField3"),
+      GOUT_DESC("Regridded gridded fields."),
+      IN("p_grid", "lat_true", "lon_true"),
+      GIN("input", "interp_order", "zeropadding"),
+      GIN_TYPE("ArrayOfGriddedField3", "Index", "Index"),
+      GIN_DEFAULT(NODEF, "1", "0"),
+      GIN_DESC("Raw input gridded fields.",
+               "Interpolation order.",
+               "Apply zero-padding.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("GriddedFieldLatLonRegrid"),
       DESCRIPTION(
@@ -8484,7 +8695,30 @@ R"(
           "\n"
           "If nothing else is stated, only the first column of *iy_aux* is filled,\n"
           "i.e. the column matching Stokes element I, while remaing columns are\n"
-          "are filled with zeros.\n"),
+          "are filled with zeros.\n"
+          "\n"
+          "If ``use_propmat_cache`` is set to 1, the output of\n"
+          "*propmat_clearsky_agenda* is stored and reused for all later\n"
+          "propagation path points having exactly the same atmospheric state\n"
+          "(pressure, temperature, VMRs, NLTE, Doppler shifted frequencies and\n"
+          "magnetic field, and also line-of-sight if the magnetic field is\n"
+          "non-zero). This saves time when neighbouring pencil beams, and\n"
+          "measurement blocks, pass through the same grid cells. The stored\n"
+          "data are kept for the duration of a *yCalc* or *iyCalc*, and are\n"
+          "otherwise only reused inside a single call of this method. The\n"
+          "absorption setup must not be changed inside *yCalc* when this\n"
+          "option is used.\n"
+          "\n"
+          "If ``adjoint_jacobian`` is set to 1, the analytical Jacobians are\n"
+          "obtained by weighting the transmission and source derivatives of\n"
+          "each layer directly with the transmission from the sensor, after\n"
+          "the radiance has been calculated. The derivatives of the layer\n"
+          "transmission matrices are then not stored for the complete path,\n"
+          "which reduces the memory usage when many retrieval quantities are\n"
+          "involved (the derivatives of the propagation matrix and the source\n"
+          "term are still stored for each point). The Jacobian is identical\n"
+          "to the one of the default mode. Only the first order integration\n"
+          "is supported.\n"),
       AUTHORS("Patrick Eriksson", "Richard Larsson", "Oliver Lemke"),
       OUT("iy",
           "iy_aux",
@@ -8536,10 +8770,11 @@ R"(
          "iy_transmittance",
          "rte_alonglos_v",
          "surface_props_data"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("use_propmat_cache", "adjoint_jacobian"),
+      GIN_TYPE("Index", "Index"),
+      GIN_DEFAULT("0", "0"),
+      GIN_DESC("Flag to reuse propagation matrices between calls.",
+               "Flag to calculate analytical Jacobians in adjoint mode.")));
 
   /*
   md_data_raw.push_back
@@ -8646,6 +8881,13 @@ R"(
         "The function accepts that the input atmosphere is 1D, as well as\n"
         "that there is no active cloudbox.\n"
         "\n"
+        "Neighbouring pencil beams give almost identical 1D atmospheres. If\n"
+        "DISORT is used inside *iy_independent_beam_approx_agenda*, set\n"
+        "``layer_cache_tolerance`` of *cloudbox_fieldDisort* to reuse layer\n"
+        "optical properties between the beams. Propagation matrices are\n"
+        "reused in the same way by ``use_propmat_cache`` of\n"
+        "*iyEmissionStandard*.\n"
+        "\n"
         "The constructed 1D atmosphere is exported if the GIN ``return_atm1d``\n"
         "is set to 1. The default then is to include all atmospheric fields,\n"
         "but *vmr_field* and *pnd_field* can be deselected by two of the GIN-s.\n"
@@ -11737,7 +11979,24 @@ R"(
           "\n"
           "Only \"1\" and \"RJBT\" are allowed for *iy_unit*. The value of\n"
           "*mc_error* follows the selection for *iy_unit* (both for in- and\n"
-          "output.\n"),
+          "output.\n"
+          "\n"
+          "With *parallel* set to 1, photons are traced by all available\n"
+          "threads. Each photon then gets its own random number stream,\n"
+          "derived from *mc_seed* and the photon number, and the photons are\n"
+          "added to the statistics in order. Apart from when *mc_max_time*\n"
+          "is the limiting criterion, the result does not depend on the\n"
+          "number of threads. The random number streams differ from the\n"
+          "serial mode, so the two modes give statistically equivalent but\n"
+          "not identical results.\n"
+          "\n"
+          "With *tabulated_sampling* set to 1, the phase function of each\n"
+          "scattering element is tabulated over scattering angle once per\n"
+          "call, and new directions at scattering events are drawn by\n"
+          "inverse transform sampling of these tables instead of by\n"
+          "rejection sampling. The phase matrix is then calculated only for\n"
+          "the drawn direction. This requires totally randomly oriented\n"
+          "particles, otherwise rejection sampling is used.\n"),
       AUTHORS("Cory Davis"),
       OUT("y",
           "mc_iteration_count",
@@ -11784,15 +12043,18 @@ R"(
          "mc_max_iter",
          "mc_min_iter",
          "mc_taustep_limit"),
-      GIN("l_mc_scat_order", "t_interp_order"),
-      GIN_TYPE("Index", "Index"),
-      GIN_DEFAULT("11", "1"),
+      GIN("l_mc_scat_order", "t_interp_order", "parallel", "tabulated_sampling"),
+      GIN_TYPE("Index", "Index", "Index", "Index"),
+      GIN_DEFAULT("11", "1", "0", "0"),
       GIN_DESC("The length to be given to *mc_scat_order*. Note that"
                " scattering orders equal and above this value will not"
                " be counted.",
                "Interpolation order of temperature for scattering data (so"
                " far only applied in phase matrix, not in extinction and"
-               " absorption.")));
+               " absorption.",
+               "Flag to trace photons in parallel, see above.",
+               "Flag to sample scattering directions from tabulated phase"
+               " functions, see above.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("MCRadar"),
@@ -11823,7 +12085,14 @@ R"(
           "\n"
           "Here \"1\" and \"Ze\" are the allowed options for *iy_unit_radar*.\n"
           "The value of *mc_error* follows the selection for *iy_unit_radar*\n"
-          "(both for in- and output. See *yRadar* for details of the units.\n"),
+          "(both for in- and output. See *yRadar* for details of the units.\n"
+          "\n"
+          "With *parallel* set to 1, photons are traced by all available\n"
+          "threads. Each photon then gets its own random number stream,\n"
+          "derived from *mc_seed* and the photon number, and the range bin\n"
+          "sums are combined in a fixed order. The result is then\n"
+          "independent of the number of threads, but differs from the\n"
+          "serial mode by the random numbers used.\n"),
       AUTHORS("Ian S. Adams"),
       OUT("y", "mc_error"),
       GOUT(),
@@ -11862,14 +12131,15 @@ R"(
          "mc_max_scatorder",
          "mc_seed",
          "mc_max_iter"),
-      GIN("ze_tref", "k2", "t_interp_order"),
-      GIN_TYPE("Numeric", "Numeric", "Index"),
-      GIN_DEFAULT("273.15", "-1", "1"),
+      GIN("ze_tref", "k2", "t_interp_order", "parallel"),
+      GIN_TYPE("Numeric", "Numeric", "Index", "Index"),
+      GIN_DEFAULT("273.15", "-1", "1", "0"),
       GIN_DESC("Reference temperature for conversion to Ze.",
                "Reference dielectric factor.",
                "Interpolation order of temperature for scattering data (so"
                " far only applied in phase matrix, not in extinction and"
-               " absorption.")));
+               " absorption.",
+               "Flag to trace photons in parallel, see above.")));
 
   md_data_raw.push_back(
       create_mdrecord(NAME("MCSetSeedFromTime"),
@@ -13432,7 +13702,7 @@ R"(
           "\n"
           "Only works for *atmosphere_dim* 1, spherical planets, and *ppath_lmax* < 0\n"),
       AUTHORS("Richard Larsson"),
-      OUT("ppath_field"),
+      OUT("ppath_field", "ppath_field_settings"),
       GOUT(),
       GOUT_TYPE(),
       GOUT_DESC(),
@@ -13494,9 +13764,10 @@ R"(
       DESCRIPTION(
           "Stand-alone calculation of propagation path field from sensors.\n"
           "\n"
-          "Uses *ppathCalc* internally.\n"),
+          "Uses *ppathCalc* internally. The paths are calculated in parallel.\n"
+          "*ppath_field_settings* is set to be empty.\n"),
       AUTHORS("Richard Larsson"),
-      OUT("ppath_field"),
+      OUT("ppath_field", "ppath_field_settings"),
       GOUT(),
       GOUT_TYPE(),
       GOUT_DESC(),
@@ -13516,6 +13787,51 @@ R"(
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppath_fieldStepByStep"),
+      DESCRIPTION(
+          "Calculates the propagation paths of all pencil beams of *yCalc*.\n"
+          "\n"
+          "One path is calculated for each combination of measurement block\n"
+          "and *mblock_dlos*, with the same ordering as in *yCalc* (the\n"
+          "*mblock_dlos* index running fastest). The paths are calculated in\n"
+          "the same way as by *ppathStepByStep*, but traced in parallel.\n"
+          "\n"
+          "The result is intended for *ppathFromPpathField*, which lets\n"
+          "later calls of *yCalc* reuse the paths. The settings affecting\n"
+          "the paths are stored in *ppath_field_settings*, to be checked by\n"
+          "*ppathFromPpathField*. The atmospheric fields are not stored, and\n"
+          "the field must be recalculated if *t_field*, *vmr_field* or\n"
+          "*refr_index_air_field* are changed for refracted paths.\n"),
+      AUTHORS("agent"),
+      OUT("ppath_field", "ppath_field_settings"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("ppath_step_agenda",
+         "ppath_inside_cloudbox_do",
+         "atmosphere_dim",
+         "p_grid",
+         "lat_grid",
+         "lon_grid",
+         "z_field",
+         "f_grid",
+         "refellipsoid",
+         "z_surface",
+         "atmgeom_checked",
+         "cloudbox_on",
+         "cloudbox_limits",
+         "cloudbox_checked",
+         "sensor_pos",
+         "sensor_los",
+         "mblock_dlos",
+         "ppath_lmax",
+         "ppath_lraytrace"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ppathCalcFromAltitude"),
       DESCRIPTION(
@@ -13605,6 +13921,55 @@ R"(
                "Altitude for switching to coarse step length",
                "Coarse step length.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppathFromPpathField"),
+      DESCRIPTION(
+          "Takes *ppath* from *ppath_field* when possible.\n"
+          "\n"
+          "The field is searched for a path ending at *rte_pos* with the\n"
+          "line-of-sight *rte_los*. If found, that path is returned as it is.\n"
+          "Otherwise, and always when *ppath_inside_cloudbox_do* is set, the\n"
+          "path is calculated as by *ppathStepByStep*.\n"
+          "\n"
+          "This method is intended for *ppath_agenda*, with *ppath_field*\n"
+          "set by *ppath_fieldStepByStep*. The field is indexed once, and\n"
+          "the index is reused as long as the field is unchanged.\n"
+          "\n"
+          "An error is issued if the present settings differ from the ones\n"
+          "in *ppath_field_settings*, i.e. *ppath_step_agenda*,\n"
+          "*refr_index_air_agenda*, *atmosphere_dim*, *f_grid*,\n"
+          "*refellipsoid*, the cloudbox, *ppath_lmax* and *ppath_lraytrace*,\n"
+          "and if a found path does not match *z_field*. Changes of\n"
+          "*t_field*, *vmr_field* and *refr_index_air_field* are not\n"
+          "detected, and the field must then be recalculated by the user.\n"),
+      AUTHORS("agent"),
+      OUT("ppath"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("ppath_field",
+         "ppath_field_settings",
+         "ppath_step_agenda",
+         "ppath_inside_cloudbox_do",
+         "atmosphere_dim",
+         "p_grid",
+         "lat_grid",
+         "lon_grid",
+         "z_field",
+         "f_grid",
+         "refellipsoid",
+         "z_surface",
+         "cloudbox_on",
+         "cloudbox_limits",
+         "rte_pos",
+         "rte_los",
+         "ppath_lmax",
+         "ppath_lraytrace"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ppathFromRtePos2"),
       DESCRIPTION(
@@ -13840,6 +14205,48 @@ R"(
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppath_stepRefractionField"),
+      DESCRIPTION(
+          "As *ppath_stepRefractionBasic*, but takes the refractive index from\n"
+          "*refr_index_air_field*.\n"
+          "\n"
+          "*refr_index_air_agenda* is not executed. The refractive index, and\n"
+          "its gradients, are instead interpolated from *refr_index_air_field*,\n"
+          "that must be set by *refr_index_air_fieldCalc*. The interpolation\n"
+          "is made in the same way as for pressure, that is, in log(n-1)\n"
+          "vertically, as long as all values involved exceed 1. The gradients\n"
+          "are derived from the interpolated field, and are thus consistent\n"
+          "with the refractive index used.\n"
+          "\n"
+          "This is much faster than *ppath_stepRefractionBasic* when\n"
+          "*ppath_lraytrace* is small, while the difference to the refractive\n"
+          "index of the agenda is normally negligible.\n"),
+      AUTHORS("agent"),
+      OUT("ppath_step"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("refr_index_air_field",
+         "ppath_step",
+         "atmosphere_dim",
+         "p_grid",
+         "lat_grid",
+         "lon_grid",
+         "z_field",
+         "refellipsoid",
+         "z_surface",
+         "ppath_lmax",
+         "ppath_lraytrace"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC(),
+      SETMETHOD(false),
+      AGENDAMETHOD(false),
+      USES_TEMPLATES(false),
+      PASSWORKSPACE(true)));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ppvar_optical_depthFromPpvar_trans_cumulat"),
       DESCRIPTION(
@@ -15699,17 +16106,23 @@ approximations.   Change the value of no_negatives to 0 to allow these negative
           "\n"
           "Important, the first dimension must be the frequency dimension!\n"
           "If a field  like *spectral_radiance_field* is input, the stokes dimension\n"
-          "is also removed.\n"),
+          "is also removed.\n"
+          "\n"
+          "By default the integration is done by the trapezoidal rule. If\n"
+          "``f_grid_weights`` is given, the field is instead summed using these\n"
+          "weights, as needed for a k-distribution *f_grid*.\n"),
       AUTHORS("Manfred Brath"),
       OUT(),
       GOUT("radiation_field"),
       GOUT_TYPE("Tensor4, Tensor5"),
       GOUT_DESC("Field similar to irradiance field or spectral irradiance field"),
       IN("f_grid"),
-      GIN("spectral_radiation_field"),
-      GIN_TYPE("Tensor5, Tensor7"),
-      GIN_DEFAULT(NODEF),
-      GIN_DESC("Field similar to spectral irradiance field, spectral radiance field")));
+      GIN("spectral_radiation_field", "f_grid_weights"),
+      GIN_TYPE("Tensor5, Tensor7", "Vector"),
+      GIN_DEFAULT(NODEF, "[]"),
+      GIN_DESC("Field similar to spectral irradiance field, spectral radiance field",
+               "Spectral integration weights of *f_grid*, e.g. from "
+               "*f_gridCorrelatedK*. If empty, trapezoidal integration is used.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("line_irradianceCalcForSingleSpeciesNonOverlappingLinesPseudo2D"),
@@ -16616,6 +17029,36 @@ where N>=0 and the species name is something line "H2O".
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("refr_index_air_fieldCalc"),
+      DESCRIPTION(
+          "Calculates the refractive index of air at all atmospheric grid points.\n"
+          "\n"
+          "*refr_index_air_agenda* is executed for each point of the atmospheric\n"
+          "grids, and the result is stored in *refr_index_air_field*. The field\n"
+          "is used by *ppath_stepRefractionField*, that then does not need to\n"
+          "execute the agenda for every ray tracing step.\n"
+          "\n"
+          "The field is calculated for the present *f_grid*. The method must be\n"
+          "called again if the atmosphere or the frequencies are changed.\n"),
+      AUTHORS("agent"),
+      OUT("refr_index_air_field"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("refr_index_air_agenda",
+         "atmosphere_dim",
+         "p_grid",
+         "lat_grid",
+         "lon_grid",
+         "t_field",
+         "vmr_field",
+         "f_grid"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("retrievalDefClose"),
       DESCRIPTION(
@@ -19399,7 +19842,18 @@ where N>=0 and the species name is something line "H2O".
           "For up-welling radiation (scat_za > 90), this variable holds the\n"
           "transmittance to space, for considered position and propagation direction.\n"
           "For down-welling radiation, ``trans_field`` holds instead the transmittance\n"
-          "down to the surface.\n"),
+          "down to the surface.\n"
+          "\n"
+          "If ``share_propmat`` is set, the propagation matrix and the source\n"
+          "function are calculated once per pressure level and shared by all\n"
+          "zenith angles, which differ then only in path length. This\n"
+          "requires that the absorption does not depend on the direction, i.e.\n"
+          "no winds, magnetic field or *rte_alonglos_v*. The path steps then\n"
+          "go between the pressure levels, and *ppath_lmax* is ignored except\n"
+          "for the radiation reflected by the surface. The vertical resolution\n"
+          "is thus set by *p_grid* alone. The number of absorption\n"
+          "calculations is reduced by a factor of about the number of\n"
+          "zenith angles.\n"),
       AUTHORS("Patrick Eriksson"),
       OUT("spectral_radiance_field"),
       GOUT("trans_field"),
@@ -19431,10 +19885,11 @@ where N>=0 and the species name is something line "H2O".
          "rt_integration_option",
          "surface_props_data",
          "za_grid"),
-      GIN("use_parallel_za"),
-      GIN_TYPE("Index"),
-      GIN_DEFAULT("1"),
-      GIN_DESC("Flag to select parallelization over zenith angles.")));
+      GIN("use_parallel_za", "share_propmat"),
+      GIN_TYPE("Index", "Index"),
+      GIN_DEFAULT("1", "0"),
+      GIN_DESC("Flag to select parallelization over zenith angles.",
+               "Flag to share the propagation matrix between zenith angles.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("spectral_radiance_fieldCopyCloudboxField"),
@@ -22965,6 +23420,40 @@ where N>=0 and the species name is something line "H2O".
           "Jacobians are also collected, and stored in output variable *ybatch_jacobians*. \n"
           "(This will be empty if *yCalc* produces empty Jacobians.)\n"
           "\n"
+          "For large batches the results can instead be streamed to disk, by\n"
+          "setting ``filename``. The jobs are then grouped in chunks of\n"
+          "``chunk_size`` consecutive jobs, and each chunk is written, as soon\n"
+          "as all its jobs are done, to the binary XML files:\n"
+          "\n"
+          "   <filename>.<i0>.ybatch.xml\n"
+          "   <filename>.<i0>.ybatch_aux.xml\n"
+          "   <filename>.<i0>.ybatch_jacobians.xml\n"
+          "\n"
+          "where i0 is the *ybatch_index* of the first job in the chunk. These\n"
+          "files hold the corresponding parts of *ybatch*, *ybatch_aux* and\n"
+          "*ybatch_jacobians*, which are left empty. Existing files are\n"
+          "overwritten. With ``resume`` set, chunks whose ybatch file already\n"
+          "exists are instead not calculated again, so an interrupted batch is\n"
+          "resumed by rerunning it with the same settings.\n"
+          "\n"
+          "The jobs are distributed over the available threads. With ``cost``\n"
+          "an estimate of the relative cost of each job can be given, the most\n"
+          "expensive jobs are then started first, which avoids that a few long\n"
+          "jobs run alone at the end of the batch. By default one job is run\n"
+          "per thread. Batches of few but large jobs can instead run fewer\n"
+          "jobs at the same time, with ``max_parallel_jobs``, and let each job\n"
+          "use several threads, set by ``nthreads_per_job``. Timing and failure\n"
+          "statistics of the jobs are given on out1 at the end.\n"
+          "\n"
+          "If ARTS is compiled with MPI support and started as several MPI\n"
+          "processes (e.g. mpirun -np 4 arts ...), the jobs are instead\n"
+          "distributed over the processes. All processes run the same\n"
+          "controlfile, so each sets up its own workspace. Rank 0 hands out the\n"
+          "jobs as the processes become free and collects the results. Each\n"
+          "process, rank 0 included, calculates one job at a time, with\n"
+          "``nthreads_per_job`` or all its threads. At the end, all processes\n"
+          "hold the same *ybatch*, *ybatch_aux* and *ybatch_jacobians*.\n"
+          "\n"
           "See the user guide for further practical examples.\n"),
       AUTHORS("Stefan Buehler"),
       OUT("ybatch", "ybatch_aux", "ybatch_jacobians"),
@@ -22972,14 +23461,32 @@ where N>=0 and the species name is something line "H2O".
       GOUT_TYPE(),
       GOUT_DESC(),
       IN("ybatch_start", "ybatch_n", "ybatch_calc_agenda"),
-      GIN("robust"),
-      GIN_TYPE("Index"),
-      GIN_DEFAULT("0"),
+      GIN("robust",
+          "filename",
+          "chunk_size",
+          "resume",
+          "cost",
+          "max_parallel_jobs",
+          "nthreads_per_job"),
+      GIN_TYPE(
+          "Index", "String", "Index", "Index", "Vector", "Index", "Index"),
+      GIN_DEFAULT("0", "", "100", "0", "[]", "0", "0"),
       GIN_DESC("A flag with value 1 or 0. If set to one, the batch "
                "calculation will continue, even if individual jobs fail. In "
                "that case, a warning message is written to screen and file "
                "(out1 output stream), and the *y* Vector entry for the "
-               "failed job in *ybatch* is left empty.")));
+               "failed job in *ybatch* is left empty.",
+               "If not empty, results are streamed to files with this "
+               "basename instead of being kept in memory.",
+               "Number of jobs per file when streaming to file.",
+               "A flag with value 1 or 0. If set to one, chunks already "
+               "written to file are not calculated again.",
+               "Estimated relative cost of each job, one element per job. "
+               "Expensive jobs are started first. Not used if empty.",
+               "Maximum number of jobs calculated at the same time. 0 gives "
+               "one job per thread.",
+               "Number of threads used inside each job. 0 shares all threads "
+               "between the jobs calculated at the same time.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("yColdAtmHot"),
@@ -24207,6 +24714,10 @@ Options are:
 
     1. Uses *ppathStepByStep* to set *ppath*
 
+- ``"FollowSensorLosPathField"``:
+
+    1. Uses *ppathFromPpathField* to set *ppath*
+
 - ``"PlaneParallel"``:
 
     1. Uses *ppathPlaneParallel* to set *ppath*
@@ -24243,6 +24754,9 @@ Options are:
 - ``"RefractedPath"``:
 
     1. Uses *ppath_stepRefractionBasic* to modify *ppath*
+- ``"RefractedPathField"``:
+
+    1. Uses *ppath_stepRefractionField* to modify *ppath*
 )--"),
                       AUTHORS("Richard Larsson"),
                       OUT("ppath_step_agenda"),
@@ -27,6 +27,7 @@
   === External declarations
   ===========================================================================*/
 
+#include <algorithm>
 #include <cfloat>
 #include <sstream>
 
@@ -37,6 +38,7 @@
 #include "mc_interp.h"
 #include "montecarlo.h"
 
+inline constexpr Numeric PI=Constant::pi;
 inline constexpr Numeric SPEED_OF_LIGHT=Constant::speed_of_light;
 
 // Some root-finding helper functions (for MCRadar) that don't need
@@ -1606,7 +1608,223 @@ void Sample_los(VectorView new_rte_los,
   g_los_csc_theta = Z(0, 0) / Csca;
 }
 
+MCPhaseFunctionTable::MCPhaseFunctionTable(
+    const ArrayOfArrayOfSingleScatteringData& scat_data, const Index f_index) {
+  // Common grid of scattering angles
+  std::vector<Numeric> th;
+  for (const auto& ss : scat_data) {
+    for (const auto& se : ss) {
+      if (se.ptype != PTYPE_TOTAL_RND) return;
+      th.insert(th.end(), se.za_grid.begin(), se.za_grid.end());
+    }
+  }
+  std::sort(th.begin(), th.end());
+  th.erase(std::unique(th.begin(), th.end()), th.end());
+  if (th.size() < 2 || th.front() != 0 || th.back() != 180) return;
+
+  const Index nth = static_cast<Index>(th.size());
+  theta.resize(nth);
+  mu.resize(nth);
+  for (Index i = 0; i < nth; i++) {
+    theta[i] = th[i];
+    mu[i] = Conversion::cosd(th[i]);
+  }
+
+  ArrayOfVector t_grid_new;
+  ArrayOfMatrix z11_new;
+  for (const auto& ss : scat_data) {
+    for (const auto& se : ss) {
+      const Index fi = se.pha_mat_data.nlibraries() == 1 ? 0 : f_index;
+      const Index nt = se.pha_mat_data.nvitrines();
+      const Index nza = se.za_grid.nelem();
+      if (nza < 2 || se.za_grid[0] != 0 || se.za_grid[nza - 1] != 180) return;
+
+      // Linear interpolation in scattering angle. theta contains all
+      // values of za_grid, so each theta falls inside a single za_grid cell.
+      Matrix tab(nt, nth);
+      Index iza = 0;
+      for (Index i = 0; i < nth; i++) {
+        while (iza < nza - 2 && se.za_grid[iza + 1] < theta[i]) iza++;
+        const Numeric w = (theta[i] - se.za_grid[iza]) /
+                          (se.za_grid[iza + 1] - se.za_grid[iza]);
+        for (Index it = 0; it < nt; it++) {
+          tab(it, i) =
+              (1 - w) * se.pha_mat_data(fi, it, iza, 0, 0, 0, 0) +
+              w * se.pha_mat_data(fi, it, iza + 1, 0, 0, 0, 0);
+        }
+      }
+
+      t_grid_new.push_back(se.T_grid);
+      z11_new.push_back(std::move(tab));
+    }
+  }
+
+  t_grid = std::move(t_grid_new);
+  z11 = std::move(z11_new);
+}
+
+bool MCPhaseFunctionTable::sample(VectorView new_rte_los,
+                                  Numeric& pdf,
+                                  RandomNumberGenerator<>& rng,
+                                  ConstVectorView rte_los,
+                                  ConstVectorView pnd_vec,
+                                  const Numeric temperature) const {
+  ARTS_ASSERT(usable());
+  ARTS_ASSERT(pnd_vec.nelem() == z11.nelem());
+
+  // Bulk phase function, linear interpolation in temperature
+  const Index nth = theta.nelem();
+  Vector zbulk(nth, 0.0);
+  for (Index i = 0; i < z11.nelem(); i++) {
+    if (pnd_vec[i] == 0) continue;
+
+    const Matrix& tab = z11[i];
+    const Vector& tg = t_grid[i];
+    const Index nt = tab.nrows();
+    Index it = 0;
+    Numeric w = 0;
+    if (nt > 1 && temperature > tg[0]) {
+      if (temperature >= tg[nt - 1]) {
+        it = nt - 2;
+        w = 1;
+      } else {
+        it = std::upper_bound(tg.begin(), tg.end(), temperature) - tg.begin() -
+             1;
+        w = (temperature - tg[it]) / (tg[it + 1] - tg[it]);
+      }
+    }
+    for (Index j = 0; j < nth; j++) {
+      zbulk[j] += pnd_vec[i] *
+                  ((1 - w) * tab(it, j) + (w > 0 ? w * tab(it + 1, j) : 0));
+    }
+  }
+
+  // Cumulative distribution, the phase function taken as constant in mu
+  // inside each cell
+  Vector cdf(nth);
+  cdf[0] = 0;
+  for (Index k = 0; k < nth - 1; k++) {
+    cdf[k + 1] = cdf[k] + 0.5 * (zbulk[k] + zbulk[k + 1]) * (mu[k] - mu[k + 1]);
+  }
+  const Numeric wtot = cdf[nth - 1];
+  if (not(wtot > 0)) return false;
+
+  // Draw cell, mu inside the cell and azimuth around the present direction
+  const Numeric r = rng.get(0.0, 1.0)() * wtot;
+  Index k = std::upper_bound(cdf.begin(), cdf.end(), r) - cdf.begin() - 1;
+  k = std::clamp<Index>(k, 0, nth - 2);
+  while (k > 0 && cdf[k + 1] == cdf[k]) k--;
+
+  const Numeric mu_s = mu[k + 1] + (mu[k] - mu[k + 1]) * rng.get(0.0, 1.0)();
+  const Numeric phi = 2 * PI * rng.get(0.0, 1.0)();
+  pdf = 0.5 * (zbulk[k] + zbulk[k + 1]) / (2 * PI * wtot);
+
+  // Rotate into the frame of the present line of sight. The scattering
+  // angle is the same between the lines of sight as between the
+  // propagation directions.
+  Numeric dx, dy, dz;
+  zaaa2cart(dx, dy, dz, rte_los[0], rte_los[1]);
+  const bool use_z = abs(dz) < 0.9;
+  Numeric e1x = use_z ? -dy : 0, e1y = use_z ? dx : -dz,
+          e1z = use_z ? 0 : dy;
+  const Numeric e1n = sqrt(e1x * e1x + e1y * e1y + e1z * e1z);
+  e1x /= e1n;
+  e1y /= e1n;
+  e1z /= e1n;
+  const Numeric e2x = dy * e1z - dz * e1y, e2y = dz * e1x - dx * e1z,
+                e2z = dx * e1y - dy * e1x;
+
+  const Numeric sin_s = sqrt(max(0.0, 1 - mu_s * mu_s));
+  const Numeric c = sin_s * cos(phi), s = sin_s * sin(phi);
+  cart2zaaa(new_rte_los[0],
+            new_rte_los[1],
+            mu_s * dx + c * e1x + s * e2x,
+            mu_s * dy + c * e1y + s * e2y,
+            mu_s * dz + c * e1z + s * e2z);
+  return true;
+}
+
+void Sample_los_tabulated(VectorView new_rte_los,
+                          Numeric& g_los_csc_theta,
+                          MatrixView Z,
+                          RandomNumberGenerator<>& rng,
+                          ConstVectorView rte_los,
+                          const MCPhaseFunctionTable& pfct_table,
+                          const ArrayOfArrayOfSingleScatteringData& scat_data,
+                          const Index f_index,
+                          const Index stokes_dim,
+                          ConstVectorView pnd_vec,
+                          ConstVectorView Z11maxvector,
+                          const Numeric Csca,
+                          const Numeric rtp_temperature,
+                          const Index t_interp_order) {
+  if (not pfct_table.usable() or
+      not pfct_table.sample(new_rte_los,
+                            g_los_csc_theta,
+                            rng,
+                            rte_los,
+                            pnd_vec,
+                            rtp_temperature)) {
+    Sample_los(new_rte_los,
+               g_los_csc_theta,
+               Z,
+               rng,
+               rte_los,
+               scat_data,
+               f_index,
+               stokes_dim,
+               pnd_vec,
+               Z11maxvector,
+               Csca,
+               rtp_temperature,
+               t_interp_order);
+    return;
+  }
+
+  Vector sca_dir, inc_dir;
+  mirror_los(sca_dir, rte_los, 3);
+  mirror_los(inc_dir, new_rte_los, 3);
+
+  ArrayOfArrayOfTensor6 pha_mat_Nse;
+  ArrayOfArrayOfIndex ptypes_Nse;
+  Matrix t_ok;
+  ArrayOfTensor6 pha_mat_ssbulk;
+  ArrayOfIndex ptype_ssbulk;
+  Tensor6 pha_mat_bulk;
+  Index ptype_bulk;
+  Matrix pdir(1, 2), idir(1, 2);
+  Vector t(1, rtp_temperature);
+  Matrix pnds(pnd_vec.nelem(), 1);
+  pnds(joker, 0) = pnd_vec;
+
+  pdir(0, joker) = sca_dir;
+  idir(0, joker) = inc_dir;
+  pha_mat_NScatElems(pha_mat_Nse,
+                     ptypes_Nse,
+                     t_ok,
+                     scat_data,
+                     stokes_dim,
+                     t,
+                     pdir,
+                     idir,
+                     f_index,
+                     t_interp_order);
+  pha_mat_ScatSpecBulk(
+      pha_mat_ssbulk, ptype_ssbulk, pha_mat_Nse, ptypes_Nse, pnds, t_ok);
+  pha_mat_Bulk(pha_mat_bulk, ptype_bulk, pha_mat_ssbulk, ptype_ssbulk);
+  Z = pha_mat_bulk(0, 0, 0, 0, joker, joker);
+}
+
 void Sample_los_uniform(VectorView new_rte_los, RandomNumberGenerator<>& rng) {
   new_rte_los[1] = rng.get<>(-180., 180.)();
   new_rte_los[0] = Conversion::acosd(rng.get<>(-1., 1.)());
 }
+
+std::uint64_t mc_photon_seed(const Index mc_seed, const Index photon) {
+  std::uint64_t z = static_cast<std::uint64_t>(mc_seed) +
+                    (static_cast<std::uint64_t>(photon) + 1) *
+                        0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
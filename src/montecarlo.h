@@ -21,6 +21,7 @@
   === External declarations
   ===========================================================================*/
 #include <cmath>
+#include <cstdint>
 #include <stdexcept>
 #include "arts.h"
 #include "check_input.h"
@@ -437,4 +438,117 @@ void Sample_los(VectorView new_rte_los,
  */
 void Sample_los_uniform(VectorView new_rte_los, RandomNumberGenerator<>& rng);
 
+/** Tabulated phase functions for sampling of scattering directions.
+ *
+ * Holds, for each scattering element and temperature of its T_grid, the
+ * phase function (Z11) over a common grid of scattering angles. At a
+ * scattering event, the bulk phase function is formed from these tables and
+ * the new direction is drawn by inverse transform sampling, without any
+ * rejection loop. The table is only set up if all scattering elements are
+ * totally randomly oriented, see usable().
+ */
+class MCPhaseFunctionTable {
+ public:
+  MCPhaseFunctionTable() = default;
+
+  /** Sets up the table.
+   *
+   * @param[in] scat_data  As the WSV.
+   * @param[in] f_index    Frequency index, as for pha_mat_NScatElems.
+   */
+  MCPhaseFunctionTable(const ArrayOfArrayOfSingleScatteringData& scat_data,
+                       const Index f_index);
+
+  /** True if the table can be used for sampling. */
+  [[nodiscard]] bool usable() const { return not z11.empty(); }
+
+  /** Samples a new line of sight.
+   *
+   * The bulk phase function is taken as piecewise constant in the cosine of
+   * the scattering angle, with the mean of the bounding grid values inside
+   * each cell. The returned probability density is exactly the one the
+   * direction was drawn from, so the Monte Carlo estimate stays unbiased.
+   *
+   * @param[out]    new_rte_los  Incident line of sight for subsequent
+   *                             ray-tracing.
+   * @param[out]    pdf          Probability density of new_rte_los, per
+   *                             steradian.
+   * @param[in,out] rng          Random number generator instance.
+   * @param[in]     rte_los      Current line of sight.
+   * @param[in]     pnd_vec      Particle number density of each scattering
+   *                             element.
+   * @param[in]     temperature  Temperature at the scattering point.
+   * @return False if the bulk phase function vanishes, and nothing was
+   * sampled.
+   */
+  bool sample(VectorView new_rte_los,
+              Numeric& pdf,
+              RandomNumberGenerator<>& rng,
+              ConstVectorView rte_los,
+              ConstVectorView pnd_vec,
+              const Numeric temperature) const;
+
+ private:
+  //! Scattering angles [deg], from 0 to 180
+  Vector theta;
+
+  //! Cosine of theta
+  Vector mu;
+
+  //! Temperature grid of each scattering element
+  ArrayOfVector t_grid;
+
+  //! Z11 of each scattering element, (temperature, scattering angle)
+  ArrayOfMatrix z11;
+};
+
+/** Sample_los_tabulated.
+ *
+ * As Sample_los, but the new direction is drawn from a MCPhaseFunctionTable.
+ * The phase matrix is then calculated once, for the drawn direction. Falls
+ * back to Sample_los if the table is not usable.
+ *
+ * @param[out]    new_rte_los      Incident line of sight for subsequent
+ *                                 ray-tracing.
+ * @param[out]    g_los_csc_theta  Probability density of new_rte_los.
+ * @param[out]    Z                Bulk phase matrix in Stokes notation.
+ * @param[in,out] rng              Rng random number generator instance.
+ * @param[in]     rte_los          Incident line of sight for subsequent
+ *                                 ray-tracing.
+ * @param[in]     pfct_table       Tabulated phase functions.
+ * @param[in]     scat_data        As the WSV.
+ * @param[in]     stokes_dim       As the WSV.
+ * @param[out]    pnd_vec          Vector of particle number densities (one element per scattering element).
+ * @param[in]     Z11maxvector     Vector holding the maximum phase function for each scattering element.
+ * @param[in]     Csca             Scattering cross section
+ * @param[in]     rtp_temperature  As the WSV.
+ */
+void Sample_los_tabulated(VectorView new_rte_los,
+                          Numeric& g_los_csc_theta,
+                          MatrixView Z,
+                          RandomNumberGenerator<>& rng,
+                          ConstVectorView rte_los,
+                          const MCPhaseFunctionTable& pfct_table,
+                          const ArrayOfArrayOfSingleScatteringData& scat_data,
+                          const Index f_index,
+                          const Index stokes_dim,
+                          ConstVectorView pnd_vec,
+                          ConstVectorView Z11maxvector,
+                          const Numeric Csca,
+                          const Numeric rtp_temperature,
+                          const Index t_interp_order = 1);
+
+/** Seed of an individual photon.
+ *
+ * Mixes the user seed and the photon number with the SplitMix64 finalizer.
+ * Every photon thus gets its own, statistically independent random number
+ * stream that does not depend on which thread traces it, nor on the order
+ * in which photons are traced.
+ *
+ * @param[in] mc_seed  As the WSV.
+ * @param[in] photon   Photon number, starting at 0.
+ * @return The seed to give to RandomNumberGenerator::force_seed.
+ */
+std::uint64_t mc_photon_seed(const Index mc_seed, const Index photon);
+
 #endif  // montecarlo_h
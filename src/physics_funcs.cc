@@ -310,6 +310,63 @@ Vector dplanck_dt(const ConstVectorView& f, const Numeric& t) {
   return dbdt;
 }
 
+/** planck
+ *
+ * Calculates the Planck function and its temperature derivative for a
+ * single temperature and a vector of frequencies.
+ *
+ * A single expm1 is evaluated per frequency, and the results are identical
+ * to those of planck and dplanck_dt.
+ *
+ * @param[out] b     Blackbody radiation.
+ * @param[out] dbdt  Blackbody radiation temperature derivative.
+ * @param[in]  f     Frequency.
+ * @param[in]  t     Temperature.
+ */
+void planck(VectorView b,
+            VectorView dbdt,
+            const ConstVectorView& f,
+            const Numeric& t) {
+  ARTS_USER_ERROR_IF (b.nelem() not_eq f.nelem() or dbdt.nelem() not_eq f.nelem(),
+                      "Vector size mismatch: frequency dim is bad")
+  PlanckFrequencyFactors(f).planck(b, dbdt, t);
+}
+
+PlanckFrequencyFactors::PlanckFrequencyFactors(const ConstVectorView& f)
+    : af3(f.nelem()), abf4(f.nelem()), bf(f.nelem()) {
+  constexpr Numeric a = 2 * Constant::h / Math::pow2(Constant::c);
+  constexpr Numeric b = Constant::h / Constant::k;
+
+  for (Index i = 0; i < f.nelem(); i++) {
+    ARTS_USER_ERROR_IF (f[i] <= 0, "Non-positive frequency")
+    af3[i] = a * Math::pow3(f[i]);
+    abf4[i] = a * b * Math::pow4(f[i]);
+    bf[i] = b * f[i];
+  }
+}
+
+void PlanckFrequencyFactors::planck(VectorView b, const Numeric& t) const {
+  ARTS_USER_ERROR_IF (t <= 0, "Non-positive temperature")
+  ARTS_ASSERT(b.nelem() == nelem())
+
+  for (Index i = 0; i < nelem(); i++) b[i] = af3[i] / std::expm1(bf[i] / t);
+}
+
+void PlanckFrequencyFactors::planck(VectorView b,
+                                    VectorView dbdt,
+                                    const Numeric& t) const {
+  ARTS_USER_ERROR_IF (t <= 0, "Non-positive temperature")
+  ARTS_ASSERT(b.nelem() == nelem() and dbdt.nelem() == nelem())
+
+  const Numeric t2 = Math::pow2(t);
+  for (Index i = 0; i < nelem(); i++) {
+    const Numeric em1 = std::expm1(bf[i] / t);
+    const Numeric inv_exp_t_m1 = 1.0 / em1;
+    b[i] = af3[i] / em1;
+    dbdt[i] = abf4[i] * inv_exp_t_m1 * (1 + inv_exp_t_m1) / t2;
+  }
+}
+
 /** dplanck_df
  *
  * Calculates the frequency derivative of the Planck function
@@ -92,6 +92,35 @@ void dplanck_dt(VectorView b, const ConstVectorView& f, const Numeric& t);
 
 Vector dplanck_dt(const ConstVectorView& f, const Numeric& t);
 
+void planck(VectorView b,
+            VectorView dbdt,
+            const ConstVectorView& f,
+            const Numeric& t);
+
+/** Frequency factors of the Planck function
+ *
+ * Holds 2hf^3/c^2, 2h^2f^4/(kc^2) and hf/k for a fixed frequency grid, so
+ * that the Planck function, and its temperature derivative, can be
+ * evaluated for many temperatures with a single expm1 per frequency and
+ * temperature. The results are identical to planck and dplanck_dt.
+ */
+class PlanckFrequencyFactors {
+  Vector af3;
+  Vector abf4;
+  Vector bf;
+
+ public:
+  PlanckFrequencyFactors() = default;
+
+  explicit PlanckFrequencyFactors(const ConstVectorView& f);
+
+  [[nodiscard]] Index nelem() const { return bf.nelem(); }
+
+  void planck(VectorView b, const Numeric& t) const;
+
+  void planck(VectorView b, VectorView dbdt, const Numeric& t) const;
+};
+
 Numeric dplanck_df(const Numeric& f, const Numeric& t);
 
 Vector dplanck_df(const ConstVectorView& f, const Numeric& t);
@@ -16,7 +16,10 @@
   ===========================================================================*/
 
 #include "ppath.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <iomanip>
 #include <stdexcept>
 #include "agenda_class.h"
 #include "array.h"
@@ -3383,6 +3386,7 @@ void ppath_step_geom_3d(Ppath& ppath,
    @param[in]   f_grid          As the WSV with the same name.
    @param[in]   lmax            As the WSV ppath_lmax
    @param[in]   refr_index_air_agenda   The WSV with the same name.
+   @param[in]   refr_index_air_field    The WSV with the same name.
    @param[in]   lraytrace       Maximum allowed length for ray tracing steps.
    @param[in]   r_surface       Radius of the surface.
    @param[in]   r1              Radius of lower pressure level.
@@ -3410,6 +3414,7 @@ void raytrace_1d_linear_basic(Workspace& ws,
                               ConstVectorView f_grid,
                               const Numeric& lmax,
                               const Agenda& refr_index_air_agenda,
+                              ConstTensor4View refr_index_air_field,
                               const Numeric& lraytrace,
                               const Numeric& rsurface,
                               const Numeric& r1,
@@ -3426,6 +3431,7 @@ void raytrace_1d_linear_basic(Workspace& ws,
                     refr_index_air,
                     refr_index_air_group,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     refellipsoid,
                     z_field,
@@ -3503,6 +3509,7 @@ void raytrace_1d_linear_basic(Workspace& ws,
                       refr_index_air_group,
                       dndr,
                       refr_index_air_agenda,
+                      refr_index_air_field,
                       p_grid,
                       refellipsoid,
                       z_field,
@@ -3549,6 +3556,7 @@ void ppath_step_refr_1d(Workspace& ws,
                         const Numeric& z_surface,
                         const Numeric& lmax,
                         const Agenda& refr_index_air_agenda,
+                        ConstTensor4View refr_index_air_field,
                         const String& rtrace_method,
                         const Numeric& lraytrace) {
   // Starting radius, zenith angle and latitude
@@ -3572,6 +3580,7 @@ void ppath_step_refr_1d(Workspace& ws,
                       refr_index_air,
                       refr_index_air_group,
                       refr_index_air_agenda,
+                      refr_index_air_field,
                       p_grid,
                       refellipsoid,
                       z_field,
@@ -3616,6 +3625,7 @@ void ppath_step_refr_1d(Workspace& ws,
                              f_grid,
                              lmax,
                              refr_index_air_agenda,
+                             refr_index_air_field,
                              lraytrace,
                              refellipsoid[0] + z_surface,
                              refellipsoid[0] + z_field(ip, 0, 0),
@@ -3684,6 +3694,7 @@ void ppath_step_refr_1d(Workspace& ws,
    @param[in]   f_grid          As the WSV with the same name.
    @param[in]   lmax            As the WSV ppath_lmax
    @param[in]   refr_index_air_agenda   The WSV with the same name.
+   @param[in]   refr_index_air_field    The WSV with the same name.
    @param[in]   lraytrace       Maximum allowed length for ray tracing steps.
    @param[in]   lat1            Latitude of left end face of the grid cell.
    @param[in]   lat3            Latitude of right end face  of the grid cell.
@@ -3717,6 +3728,7 @@ void raytrace_2d_linear_basic(Workspace& ws,
                               ConstVectorView f_grid,
                               const Numeric& lmax,
                               const Agenda& refr_index_air_agenda,
+                              ConstTensor4View refr_index_air_field,
                               const Numeric& lraytrace,
                               const Numeric& lat1,
                               const Numeric& lat3,
@@ -3738,6 +3750,7 @@ void raytrace_2d_linear_basic(Workspace& ws,
                     refr_index_air,
                     refr_index_air_group,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     refellipsoid,
@@ -3834,6 +3847,7 @@ void raytrace_2d_linear_basic(Workspace& ws,
                       dndr,
                       dndlat,
                       refr_index_air_agenda,
+                      refr_index_air_field,
                       p_grid,
                       lat_grid,
                       refellipsoid,
@@ -3894,6 +3908,7 @@ void ppath_step_refr_2d(Workspace& ws,
                         ConstVectorView z_surface,
                         const Numeric& lmax,
                         const Agenda& refr_index_air_agenda,
+                        ConstTensor4View refr_index_air_field,
                         const String& rtrace_method,
                         const Numeric& lraytrace) {
   // Radius, zenith angle and latitude of start point.
@@ -3952,6 +3967,7 @@ void ppath_step_refr_2d(Workspace& ws,
                              f_grid,
                              lmax,
                              refr_index_air_agenda,
+                             refr_index_air_field,
                              lraytrace,
                              lat1,
                              lat3,
@@ -4023,6 +4039,7 @@ void ppath_step_refr_2d(Workspace& ws,
 
    @param[in]   lmax         As the WSV ppath_lmax
    @param[in]   refr_index_air_agenda    The WSV with the same name.
+   @param[in]   refr_index_air_field     The WSV with the same name.
    @param[in]   lraytrace      Maximum allowed length for ray tracing steps.
    @param[in]   refellipsoid   The WSV with the same name.
    @param[in]   p_grid         The WSV with the same name.
@@ -4077,6 +4094,7 @@ void raytrace_3d_linear_basic(Workspace& ws,
                               ConstVectorView f_grid,
                               const Numeric& lmax,
                               const Agenda& refr_index_air_agenda,
+                              ConstTensor4View refr_index_air_field,
                               const Numeric& lraytrace,
                               const Numeric& lat1,
                               const Numeric& lat3,
@@ -4108,6 +4126,7 @@ void raytrace_3d_linear_basic(Workspace& ws,
                     refr_index_air,
                     refr_index_air_group,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     lon_grid,
@@ -4225,6 +4244,7 @@ void raytrace_3d_linear_basic(Workspace& ws,
                       dndlat,
                       dndlon,
                       refr_index_air_agenda,
+                      refr_index_air_field,
                       p_grid,
                       lat_grid,
                       lon_grid,
@@ -4310,6 +4330,7 @@ void ppath_step_refr_3d(Workspace& ws,
                         ConstMatrixView z_surface,
                         const Numeric& lmax,
                         const Agenda& refr_index_air_agenda,
+                        ConstTensor4View refr_index_air_field,
                         const String& rtrace_method,
                         const Numeric& lraytrace) {
   // Radius, zenith angle and latitude of start point.
@@ -4387,6 +4408,7 @@ void ppath_step_refr_3d(Workspace& ws,
                              f_grid,
                              lmax,
                              refr_index_air_agenda,
+                             refr_index_air_field,
                              lraytrace,
                              lat1,
                              lat3,
@@ -5520,4 +5542,307 @@ void ppath_calc(Workspace& ws,
   }
 }
 
+void ppath_calc_batch(Workspace& ws,
+                      ArrayOfPpath& ppaths,
+                      const Agenda& ppath_step_agenda,
+                      const Index& atmosphere_dim,
+                      const Vector& p_grid,
+                      const Vector& lat_grid,
+                      const Vector& lon_grid,
+                      const Tensor3& z_field,
+                      const Vector& f_grid,
+                      const Vector& refellipsoid,
+                      const Matrix& z_surface,
+                      const Index& cloudbox_on,
+                      const ArrayOfIndex& cloudbox_limits,
+                      const Matrix& rte_pos,
+                      const Matrix& rte_los,
+                      const Numeric& ppath_lmax,
+                      const Numeric& ppath_lraytrace,
+                      const bool& ppath_inside_cloudbox_do,
+                      const Verbosity& verbosity) {
+  const Index n = rte_pos.nrows();
+  ARTS_USER_ERROR_IF(rte_los.nrows() != n,
+                     "The number of positions (", n,
+                     ") and line-of-sights (", rte_los.nrows(),
+                     ") differ.");
+
+  ppaths.resize(n);
+
+  // The rays are independent, and each is traced by its own copy of the
+  // workspace. The geometry routines are stepwise with per-ray branching,
+  // so this is where the batch gains its speed.
+  String fail_msg;
+  bool failed = false;
+  WorkspaceOmpParallelCopyGuard wss{ws};
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n > 1) \
+    firstprivate(wss) schedule(dynamic)
+  for (Index i = 0; i < n; i++) {
+    // Skip remaining iterations if an error occurred
+    if (failed) continue;
+
+    try {
+      ppath_calc(wss,
+                 ppaths[i],
+                 ppath_step_agenda,
+                 atmosphere_dim,
+                 p_grid,
+                 lat_grid,
+                 lon_grid,
+                 z_field,
+                 f_grid,
+                 refellipsoid,
+                 z_surface,
+                 cloudbox_on,
+                 cloudbox_limits,
+                 Vector{rte_pos(i, joker)},
+                 Vector{rte_los(i, joker)},
+                 ppath_lmax,
+                 ppath_lraytrace,
+                 ppath_inside_cloudbox_do,
+                 verbosity);
+    } catch (const std::exception& e) {
+#pragma omp critical(ppath_calc_batch_fail)
+      {
+        failed = true;
+        fail_msg = var_string("Path ", i, ": ", e.what());
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg);
+}
+
+namespace {
+/* Tolerances for matching sensor positions and LOS with the ones of a
+   ppath_field. They cover round-off in the set-up of the sensor geometry. */
+constexpr Numeric ppath_field_dz = 1e-3;
+constexpr Numeric ppath_field_dang = 1e-9;
+
+bool ppath_end_matches(const Index& atmosphere_dim,
+                       ConstVectorView end_pos,
+                       ConstVectorView end_los,
+                       ConstVectorView rte_pos,
+                       ConstVectorView rte_los) {
+  if (end_los.nelem() != rte_los.nelem() || end_pos.nelem() < atmosphere_dim)
+    return false;
+  if (abs(end_pos[0] - rte_pos[0]) > ppath_field_dz) return false;
+  if (atmosphere_dim > 1 && abs(end_pos[1] - rte_pos[1]) > ppath_field_dang)
+    return false;
+  if (atmosphere_dim == 3) {
+    // Longitudes are compared modulo 360
+    const Numeric dlon = fmod(abs(end_pos[2] - rte_pos[2]), 360);
+    if (min(dlon, 360 - dlon) > ppath_field_dang) return false;
+  }
+  for (Index j = 0; j < rte_los.nelem(); j++) {
+    if (abs(end_los[j] - rte_los[j]) > ppath_field_dang) return false;
+  }
+  return true;
+}
+
+/* Index of the end points of a ppath_field, sorted by zenith angle.
+
+   The index is built once per field and reused for all look-ups. It keeps
+   copies of the end positions and LOS. A new field is detected by its
+   address, size and identifier. A field changed in place is detected by
+   comparing a match with the actual path, and for a miss by comparing all
+   end points. The index is then rebuilt.
+ */
+class PpathFieldIndex {
+ public:
+  void build(const ArrayOfPpath& ppath_field, const String& field_id) {
+    field = &ppath_field;
+    id = field_id;
+    end_pos.resize(ppath_field.nelem());
+    end_los.resize(ppath_field.nelem());
+    order.clear();
+    for (Index i = 0; i < ppath_field.nelem(); i++) {
+      end_pos[i] = ppath_field[i].end_pos;
+      end_los[i] = ppath_field[i].end_los;
+      if (end_los[i].nelem()) order.emplace_back(end_los[i][0], i);
+    }
+    std::sort(order.begin(), order.end());
+  }
+
+  bool is_stale(const ArrayOfPpath& ppath_field,
+                const String& field_id) const {
+    return field != &ppath_field || end_pos.nelem() != ppath_field.nelem() ||
+           id != field_id;
+  }
 
+  bool is_unchanged(const ArrayOfPpath& ppath_field, const Index i) const {
+    return end_pos[i] == ppath_field[i].end_pos &&
+           end_los[i] == ppath_field[i].end_los;
+  }
+
+  bool is_unchanged(const ArrayOfPpath& ppath_field) const {
+    for (Index i = 0; i < ppath_field.nelem(); i++) {
+      if (!is_unchanged(ppath_field, i)) return false;
+    }
+    return true;
+  }
+
+  bool find(Index& index,
+            const ArrayOfPpath& ppath_field,
+            const Index& atmosphere_dim,
+            ConstVectorView rte_pos,
+            ConstVectorView rte_los) const {
+    auto it = std::lower_bound(
+        order.cbegin(),
+        order.cend(),
+        std::pair<Numeric, Index>{rte_los[0] - ppath_field_dang, -1});
+    for (; it != order.cend() && it->first <= rte_los[0] + ppath_field_dang;
+         ++it) {
+      const Index i = it->second;
+      if (ppath_field[i].dim == atmosphere_dim &&
+          ppath_end_matches(
+              atmosphere_dim, end_pos[i], end_los[i], rte_pos, rte_los)) {
+        index = i;
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  const ArrayOfPpath* field{nullptr};
+  String id;
+  ArrayOfVector end_pos;
+  ArrayOfVector end_los;
+  std::vector<std::pair<Numeric, Index>> order;
+};
+
+//! Index of the last ppath_field searched by this thread
+thread_local PpathFieldIndex ppath_field_index;
+}  // namespace
+
+bool ppath_find_in_field(Index& index,
+                         const ArrayOfPpath& ppath_field,
+                         const String& field_id,
+                         const Index& atmosphere_dim,
+                         ConstVectorView rte_pos,
+                         ConstVectorView rte_los) {
+  if (rte_los.empty()) return false;
+
+  if (ppath_field_index.is_stale(ppath_field, field_id))
+    ppath_field_index.build(ppath_field, field_id);
+
+  // A miss costs a path calculation, and checking the complete field for
+  // changes is then affordable
+  if (ppath_field_index.find(
+          index, ppath_field, atmosphere_dim, rte_pos, rte_los)) {
+    if (ppath_field_index.is_unchanged(ppath_field, index)) return true;
+  } else if (ppath_field_index.is_unchanged(ppath_field)) {
+    return false;
+  }
+
+  ppath_field_index.build(ppath_field, field_id);
+  return ppath_field_index.find(
+      index, ppath_field, atmosphere_dim, rte_pos, rte_los);
+}
+
+void ppath_check_field_path(const Ppath& ppath,
+                            const Index& atmosphere_dim,
+                            const Tensor3& z_field) {
+  // Paths with a single point are outside of the atmosphere
+  if (ppath.np < 2) return;
+
+  Vector z(ppath.np);
+  interp_atmfield_by_gp(
+      z, atmosphere_dim, z_field, ppath.gp_p, ppath.gp_lat, ppath.gp_lon);
+  for (Index i = 0; i < ppath.np; i++) {
+    ARTS_USER_ERROR_IF(abs(z[i] - ppath.pos(i, 0)) > ppath_field_dz,
+                       "The path taken from *ppath_field* is not consistent "
+                       "with *z_field*.\n"
+                       "The altitude of path point ", i, " is ",
+                       ppath.pos(i, 0), " m, but *z_field* gives ", z[i],
+                       " m.\n"
+                       "Recalculate *ppath_field* after changing the "
+                       "atmosphere.");
+  }
+}
+
+namespace {
+//! Number of ppath_field calculated so far, to tell them apart
+std::atomic<Index> ppath_field_count{0};
+
+String ppath_field_setting(const String& name, ConstVectorView values) {
+  ostringstream os;
+  os << std::setprecision(17) << name << ":";
+  for (const auto& x : values) os << ' ' << x;
+  return os.str();
+}
+
+String ppath_field_agenda(const String& name, const Agenda* agenda) {
+  ostringstream os;
+  os << name << ":";
+  if (agenda) {
+    os << '\n';
+    agenda->print(os, " ");
+  } else {
+    os << " not set";
+  }
+  return os.str();
+}
+}  // namespace
+
+String ppath_field_id(const Index& npaths) {
+  return var_string(
+      "ppath_field ", ++ppath_field_count, " with ", npaths, " paths");
+}
+
+ArrayOfString ppath_field_settings_describe(Workspace& ws,
+                                            const Agenda& ppath_step_agenda,
+                                            const Index& atmosphere_dim,
+                                            const Vector& f_grid,
+                                            const Vector& refellipsoid,
+                                            const Index& cloudbox_on,
+                                            const ArrayOfIndex& cloudbox_limits,
+                                            const Numeric& ppath_lmax,
+                                            const Numeric& ppath_lraytrace) {
+  ostringstream cloudbox;
+  cloudbox << "cloudbox_limits:";
+  if (cloudbox_on) {
+    for (const auto& i : cloudbox_limits) cloudbox << ' ' << i;
+  } else {
+    cloudbox << " off";
+  }
+
+  // Refracted paths depend on refr_index_air_agenda, used inside
+  // ppath_step_agenda
+  return {ppath_field_agenda("ppath_step_agenda", &ppath_step_agenda),
+          ppath_field_agenda("refr_index_air_agenda",
+                             ws.get<Agenda>("refr_index_air_agenda")),
+          var_string("atmosphere_dim: ", atmosphere_dim),
+          ppath_field_setting("f_grid", f_grid),
+          ppath_field_setting("refellipsoid", refellipsoid),
+          cloudbox.str(),
+          ppath_field_setting("ppath_lmax", Vector(1, ppath_lmax)),
+          ppath_field_setting("ppath_lraytrace", Vector(1, ppath_lraytrace))};
+}
+
+void ppath_field_check_settings(const ArrayOfString& ppath_field_settings,
+                                const ArrayOfPpath& ppath_field,
+                                const ArrayOfString& settings) {
+  ARTS_USER_ERROR_IF(
+      ppath_field_settings.nelem() != settings.nelem() + 1 ||
+          !ppath_field_settings[0].ends_with(
+              var_string(" with ", ppath_field.nelem(), " paths")),
+      "*ppath_field_settings* does not describe *ppath_field*.\n"
+      "Calculate *ppath_field* with *ppath_fieldStepByStep* to use it "
+      "in *ppathFromPpathField*.");
+
+  String changed;
+  for (Index i = 0; i < settings.nelem(); i++) {
+    if (ppath_field_settings[i + 1] != settings[i]) {
+      if (!changed.empty()) changed += ", ";
+      changed += settings[i].substr(0, settings[i].find(':'));
+    }
+  }
+  ARTS_USER_ERROR_IF(!changed.empty(),
+                     "*ppath_field* was calculated with other settings than "
+                     "the present ones.\n"
+                     "Changed: ", changed, "\n"
+                     "Recalculate the field with *ppath_fieldStepByStep*.");
+}
@@ -456,6 +456,133 @@ void ppath_calc(Workspace& ws,
                 const bool& ppath_inside_cloudbox_do,
                 const Verbosity& verbosity);
 
+/** Calculates a batch of propagation paths.
+
+   Performs *ppath_calc* for each row of rte_pos and rte_los. The paths are
+   traced in parallel, each with its own copy of the workspace.
+
+   @param[in] ws                 Current Workspace
+   @param[out] ppaths            One Ppath per row of rte_pos.
+   @param[in] ppath_step_agenda  As the WSM with the same name.
+   @param[in] atmosphere_dim     The atmospheric dimensionality.
+   @param[in] p_grid             The pressure grid.
+   @param[in] lat_grid           The latitude grid.
+   @param[in] lon_grid           The longitude grid.
+   @param[in] z_field            As the WSM with the same name.
+   @param[in] f_grid             As the WSM with the same name.
+   @param[in] refellipsoid       As the WSM with the same name.
+   @param[in] z_surface          Surface altitude.
+   @param[in] cloudbox_on        Flag to activate the cloud box.
+   @param[in] cloudbox_limits    Index limits of the cloud box.
+   @param[in] rte_pos            Sensor positions, one per row.
+   @param[in] rte_los            Sensor line-of-sights, one per row.
+   @param[in] ppath_lmax         As the WSM with the same name.
+   @param[in] ppath_lraytrace    As the WSM with the same name.
+   @param[in] ppath_inside_cloudbox_do  As the WSM with the same name.
+ */
+void ppath_calc_batch(Workspace& ws,
+                      ArrayOfPpath& ppaths,
+                      const Agenda& ppath_step_agenda,
+                      const Index& atmosphere_dim,
+                      const Vector& p_grid,
+                      const Vector& lat_grid,
+                      const Vector& lon_grid,
+                      const Tensor3& z_field,
+                      const Vector& f_grid,
+                      const Vector& refellipsoid,
+                      const Matrix& z_surface,
+                      const Index& cloudbox_on,
+                      const ArrayOfIndex& cloudbox_limits,
+                      const Matrix& rte_pos,
+                      const Matrix& rte_los,
+                      const Numeric& ppath_lmax,
+                      const Numeric& ppath_lraytrace,
+                      const bool& ppath_inside_cloudbox_do,
+                      const Verbosity& verbosity);
+
+/** Finds a propagation path in a ppath_field ending at a given sensor.
+
+   The match is made on end_pos and end_los of the stored paths. The field
+   is indexed at the first search, and the index is reused as long as the
+   field is unchanged. A new field is recognised by field_id, and changes
+   of the paths are detected when searching. The index is kept per thread.
+
+   @param[out] index          Position of the match in ppath_field.
+   @param[in] ppath_field     As the WSV with the same name.
+   @param[in] field_id        First element of ppath_field_settings.
+   @param[in] atmosphere_dim  The atmospheric dimensionality.
+   @param[in] rte_pos         The position of the sensor.
+   @param[in] rte_los         The line-of-sight of the sensor.
+
+   @return True if a match was found.
+ */
+bool ppath_find_in_field(Index& index,
+                         const ArrayOfPpath& ppath_field,
+                         const String& field_id,
+                         const Index& atmosphere_dim,
+                         ConstVectorView rte_pos,
+                         ConstVectorView rte_los);
+
+/** Creates the identifier of a new ppath_field.
+
+   The identifier is the first element of ppath_field_settings. It holds
+   a running number and the number of paths.
+
+   @param[in] npaths  The number of paths of the field.
+
+   @return The identifier.
+ */
+String ppath_field_id(const Index& npaths);
+
+/** Describes the settings affecting the paths of a ppath_field.
+
+   Each element describes one setting, as "name: value". The agendas are
+   described by their methods. The result, preceded by ppath_field_id, is
+   stored in ppath_field_settings.
+
+   @param[in] ws  The workspace, for refr_index_air_agenda.
+   Other input as the WSVs with the same name.
+
+   @return The settings.
+ */
+ArrayOfString ppath_field_settings_describe(Workspace& ws,
+                                            const Agenda& ppath_step_agenda,
+                                            const Index& atmosphere_dim,
+                                            const Vector& f_grid,
+                                            const Vector& refellipsoid,
+                                            const Index& cloudbox_on,
+                                            const ArrayOfIndex& cloudbox_limits,
+                                            const Numeric& ppath_lmax,
+                                            const Numeric& ppath_lraytrace);
+
+/** Checks that a ppath_field was calculated with the present settings.
+
+   An error is thrown if ppath_field_settings does not belong to the field,
+   or if any setting differs. The message names the changed settings.
+
+   @param[in] ppath_field_settings  As the WSV with the same name.
+   @param[in] ppath_field           As the WSV with the same name.
+   @param[in] settings              The present settings, as given by
+                                    ppath_field_settings_describe.
+ */
+void ppath_field_check_settings(const ArrayOfString& ppath_field_settings,
+                                const ArrayOfPpath& ppath_field,
+                                const ArrayOfString& settings);
+
+/** Checks that a path taken from a ppath_field matches the atmosphere.
+
+   The altitudes of the path points are compared with the ones given by
+   z_field at the grid positions of the path. An error is thrown if they
+   deviate, i.e. if the field was calculated for another atmosphere.
+
+   @param[in] ppath           A path of ppath_field.
+   @param[in] atmosphere_dim  The atmospheric dimensionality.
+   @param[in] z_field         As the WSV with the same name.
+ */
+void ppath_check_field_path(const Ppath& ppath,
+                            const Index& atmosphere_dim,
+                            const Tensor3& z_field);
+
 /** Copy the content in ppath2 to ppath1.
 
    The ppath1 structure must be allocated before calling the function. The
@@ -663,6 +790,8 @@ void ppath_step_geom_3d(Ppath& ppath,
    @param[in]   z_surface         Surface altitude (1D).
    @param[in]   lmax              Maximum allowed length between the path points.
    @param[in]   refr_index_air_agenda The WSV with the same name.
+   @param[in]   refr_index_air_field The WSV with the same name. The agenda
+                              is used if empty.
    @param[in]   rtrace_method     String giving which ray tracing method to use.
                               See the function for options.
    @param[in]   lraytrace         Maximum allowed length for ray tracing steps.
@@ -681,6 +810,7 @@ void ppath_step_refr_1d(Workspace& ws,
                         const Numeric& z_surface,
                         const Numeric& lmax,
                         const Agenda& refr_index_agenda,
+                        ConstTensor4View refr_index_air_field,
                         const String& rtrace_method,
                         const Numeric& lraytrace);
 
@@ -702,6 +832,8 @@ void ppath_step_refr_1d(Workspace& ws,
    @param[in]   z_surface         Surface altitudes.
    @param[in]   lmax              Maximum allowed length between the path points.
    @param[in]   refr_index_air_agenda The WSV with the same name.
+   @param[in]   refr_index_air_field The WSV with the same name. The agenda
+                              is used if empty.
    @param[in]   rtrace_method     String giving which ray tracing method to use.
                               See the function for options.
    @param[in]   lraytrace         Maximum allowed length for ray tracing steps.
@@ -721,6 +853,7 @@ void ppath_step_refr_2d(Workspace& ws,
                         ConstVectorView z_surface,
                         const Numeric& lmax,
                         const Agenda& refr_index_agenda,
+                        ConstTensor4View refr_index_air_field,
                         const String& rtrace_method,
                         const Numeric& lraytrace);
 
@@ -743,6 +876,8 @@ void ppath_step_refr_2d(Workspace& ws,
    @param[in]   z_surface         Surface altitudes.
    @param[in]   lmax              Maximum allowed length between the path points.
    @param[in]   refr_index_air_agenda The WSV with the same name.
+   @param[in]   refr_index_air_field The WSV with the same name. The agenda
+                              is used if empty.
    @param[in]   rtrace_method     String giving which ray tracing method to use.
                               See the function for options.
    @param[in]   lraytrace         Maximum allowed length for ray tracing steps.
@@ -763,6 +898,7 @@ void ppath_step_refr_3d(Workspace& ws,
                         ConstMatrixView z_surface,
                         const Numeric& lmax,
                         const Agenda& refr_index_agenda,
+                        ConstTensor4View refr_index_air_field,
                         const String& rtrace_method,
                         const Numeric& lraytrace);
 
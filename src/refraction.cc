@@ -140,6 +140,67 @@ void complex_n_ice_matzler06(Matrix& complex_n,
   }
 }
 
+//! chk_refr_index_field
+/*!
+   Checks that *refr_index_air_field* matches the atmospheric grids.
+
+   \param   refr_index_air_field  As the WSV with the same name.
+   \param   np                    Length of *p_grid*.
+   \param   nlat                  Length of *lat_grid*, 1 for 1D.
+   \param   nlon                  Length of *lon_grid*, 1 for 1D and 2D.
+*/
+static void chk_refr_index_field(ConstTensor4View refr_index_air_field,
+                                 const Index& np,
+                                 const Index& nlat,
+                                 const Index& nlon) {
+  ARTS_USER_ERROR_IF(
+      !is_size(refr_index_air_field, 2, np, nlat, nlon),
+      "*refr_index_air_field* does not match the atmospheric grids.\n"
+      "Expected size: [2, ", np, ", ", nlat, ", ", nlon, "]\n"
+      "Found size: [", refr_index_air_field.nbooks(), ", ",
+      refr_index_air_field.npages(), ", ", refr_index_air_field.nrows(), ", ",
+      refr_index_air_field.ncols(), "]")
+}
+
+//! interp_refr_index_field
+/*!
+   Interpolates one book of *refr_index_air_field* to a position.
+
+   The refractive index is interpolated linearly, everywhere in the same
+   way, so that the interpolated value is continuous between grid cells.
+
+   \param   n_field          One book of *refr_index_air_field*.
+   \param   atmosphere_dim   As the WSV with the same name.
+   \param   gp_p             Pressure grid position.
+   \param   gp_lat           Latitude grid position (ignored for 1D).
+   \param   gp_lon           Longitude grid position (ignored for 1D and 2D).
+   \return                  The refractive index at the position.
+*/
+static Numeric interp_refr_index_field(ConstTensor3View n_field,
+                                       const Index& atmosphere_dim,
+                                       const GridPos& gp_p,
+                                       const GridPos& gp_lat,
+                                       const GridPos& gp_lon) {
+  const Index nlat = atmosphere_dim > 1 ? 2 : 1;
+  const Index nlon = atmosphere_dim > 2 ? 2 : 1;
+
+  Numeric n = 0;
+  for (Index ip = 0; ip < 2; ip++) {
+    for (Index ilat = 0; ilat < nlat; ilat++) {
+      for (Index ilon = 0; ilon < nlon; ilon++) {
+        Numeric w = gp_p.fd[1 - ip];
+        if (atmosphere_dim > 1) w *= gp_lat.fd[1 - ilat];
+        if (atmosphere_dim > 2) w *= gp_lon.fd[1 - ilon];
+        if (w == 0) continue;
+        n += w * n_field(gp_p.idx + ip,
+                         atmosphere_dim > 1 ? gp_lat.idx + ilat : 0,
+                         atmosphere_dim > 2 ? gp_lon.idx + ilon : 0);
+      }
+    }
+  }
+  return n;
+}
+
 //! get_refr_index_1d
 /*! 
    Extracts the refractive index for 1D cases.
@@ -156,6 +217,8 @@ void complex_n_ice_matzler06(Matrix& complex_n,
    \param   refr_index_air          Output: As the WSV with the same name.
    \param   refr_index_air_group    Output: As the WSV with the same name.
    \param   refr_index_air_agenda   As the WSV with the same name.
+   \param   refr_index_air_field    As the WSV with the same name. The
+                                agenda is used if empty.
    \param   p_grid              As the WSV with the same name.   
    \param   refellipsoid        As the WSV with the same name.
    \param   z_field             As the WSV with the same name.
@@ -171,6 +234,7 @@ void get_refr_index_1d(Workspace& ws,
                        Numeric& refr_index_air,
                        Numeric& refr_index_air_group,
                        const Agenda& refr_index_air_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView refellipsoid,
                        ConstTensor3View z_field,
@@ -185,6 +249,15 @@ void get_refr_index_1d(Workspace& ws,
   ArrayOfGridPos gp(1);
   gridpos(gp, z_field(joker, 0, 0), Vector(1, r - refellipsoid[0]));
 
+  if (!refr_index_air_field.empty()) {
+    chk_refr_index_field(refr_index_air_field, p_grid.nelem(), 1, 1);
+    refr_index_air = interp_refr_index_field(
+        refr_index_air_field(0, joker, joker, joker), 1, gp[0], gp[0], gp[0]);
+    refr_index_air_group = interp_refr_index_field(
+        refr_index_air_field(1, joker, joker, joker), 1, gp[0], gp[0], gp[0]);
+    return;
+  }
+
   // Altitude interpolation weights
   Matrix itw(1, 2);
   interpweights(itw, gp);
@@ -234,6 +307,8 @@ void get_refr_index_1d(Workspace& ws,
    \param   refr_index_air          Output: As the WSV with the same name.
    \param   refr_index_air_group    Output: As the WSV with the same name.
    \param   refr_index_air_agenda   As the WSV with the same name.
+   \param   refr_index_air_field    As the WSV with the same name. The
+                                    agenda is used if empty.
    \param   p_grid                  As the WSV with the same name.
    \param   lat_grid                As the WSV with the same name.
    \param   refellipsoid            As the WSV with the same name.
@@ -251,6 +326,7 @@ void get_refr_index_2d(Workspace& ws,
                        Numeric& refr_index_air,
                        Numeric& refr_index_air_group,
                        const Agenda& refr_index_air_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView lat_grid,
                        ConstVectorView refellipsoid,
@@ -278,6 +354,23 @@ void get_refr_index_2d(Workspace& ws,
   ArrayOfGridPos gp_p(1);
   gridpos(gp_p, z_grid, Vector(1, r - rellips));
 
+  if (!refr_index_air_field.empty()) {
+    chk_refr_index_field(refr_index_air_field, np, lat_grid.nelem(), 1);
+    refr_index_air =
+        interp_refr_index_field(refr_index_air_field(0, joker, joker, joker),
+                                2,
+                                gp_p[0],
+                                gp_lat[0],
+                                gp_lat[0]);
+    refr_index_air_group =
+        interp_refr_index_field(refr_index_air_field(1, joker, joker, joker),
+                                2,
+                                gp_p[0],
+                                gp_lat[0],
+                                gp_lat[0]);
+    return;
+  }
+
   // Altitude interpolation weights
   Matrix itw(1, 2);
   Vector dummy(1);
@@ -325,6 +418,8 @@ void get_refr_index_2d(Workspace& ws,
    \param   refr_index_air          Output: As the WSV with the same name.
    \param   refr_index_air_group    Output: As the WSV with the same name.
    \param   refr_index_air_agenda   As the WSV with the same name.
+   \param   refr_index_air_field    As the WSV with the same name. The
+                                    agenda is used if empty.
    \param   p_grid                  As the WSV with the same name.
    \param   lat_grid                As the WSV with the same name.
    \param   lon_grid                As the WSV with the same name.
@@ -344,6 +439,7 @@ void get_refr_index_3d(Workspace& ws,
                        Numeric& refr_index_air,
                        Numeric& refr_index_air_group,
                        const Agenda& refr_index_air_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView lat_grid,
                        ConstVectorView lon_grid,
@@ -375,6 +471,24 @@ void get_refr_index_3d(Workspace& ws,
   ArrayOfGridPos gp_p(1);
   gridpos(gp_p, z_grid, Vector(1, r - rellips));
 
+  if (!refr_index_air_field.empty()) {
+    chk_refr_index_field(
+        refr_index_air_field, np, lat_grid.nelem(), lon_grid.nelem());
+    refr_index_air =
+        interp_refr_index_field(refr_index_air_field(0, joker, joker, joker),
+                                3,
+                                gp_p[0],
+                                gp_lat[0],
+                                gp_lon[0]);
+    refr_index_air_group =
+        interp_refr_index_field(refr_index_air_field(1, joker, joker, joker),
+                                3,
+                                gp_p[0],
+                                gp_lat[0],
+                                gp_lon[0]);
+    return;
+  }
+
   // Altitude interpolation weights
   Matrix itw(1, 2);
   Vector dummy(1);
@@ -425,6 +539,7 @@ void get_refr_index_3d(Workspace& ws,
    \param   refr_index_air_group  Output: As the WSV with the same name.
    \param   dndr                  Output: Radial gradient of refractive index.
    \param   refr_index_air_agenda As the WSV with the same name.
+   \param   refr_index_air_field  As the WSV with the same name.
    \param   p_grid                As the WSV with the same name.
    \param   refellipsoid          As the WSV with the same name.
    \param   z_field               As the WSV with the same name.
@@ -442,6 +557,7 @@ void refr_gradients_1d(Workspace& ws,
                        Numeric& refr_index_air_group,
                        Numeric& dndr,
                        const Agenda& refr_index_air_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView refellipsoid,
                        ConstTensor3View z_field,
@@ -453,6 +569,7 @@ void refr_gradients_1d(Workspace& ws,
                     refr_index_air,
                     refr_index_air_group,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     refellipsoid,
                     z_field,
@@ -468,6 +585,7 @@ void refr_gradients_1d(Workspace& ws,
                     refr_index_air,
                     dummy,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     refellipsoid,
                     z_field,
@@ -501,6 +619,7 @@ void refr_gradients_1d(Workspace& ws,
    \param   dndr                  Output: Radial gradient of refractive index.
    \param   dndlat                Output: Latitude gradient of refractive index.
    \param   refr_index_air_agenda As the WSV with the same name.
+   \param   refr_index_air_field  As the WSV with the same name.
    \param   p_grid                As the WSV with the same name.
    \param   lat_grid              As the WSV with the same name.
    \param   refellipsoid          As the WSV with the same name.
@@ -520,6 +639,7 @@ void refr_gradients_2d(Workspace& ws,
                        Numeric& dndr,
                        Numeric& dndlat,
                        const Agenda& refr_index_air_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView lat_grid,
                        ConstVectorView refellipsoid,
@@ -533,6 +653,7 @@ void refr_gradients_2d(Workspace& ws,
                     refr_index_air,
                     refr_index_air_group,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     refellipsoid,
@@ -550,6 +671,7 @@ void refr_gradients_2d(Workspace& ws,
                     refr_index_air,
                     dummy,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     refellipsoid,
@@ -568,6 +690,7 @@ void refr_gradients_2d(Workspace& ws,
                     refr_index_air,
                     dummy,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     refellipsoid,
@@ -605,6 +728,7 @@ void refr_gradients_2d(Workspace& ws,
    \param   dndlat               Output: Latitude gradient of refractive index.
    \param   dndlon               Output: Longitude gradient of refractive index.
    \param   refr_index_air_agenda As the WSV with the same name.
+   \param   refr_index_air_field As the WSV with the same name.
    \param   p_grid               As the WSV with the same name.
    \param   lat_grid             As the WSV with the same name.
    \param   lon_grid             As the WSV with the same name.
@@ -627,6 +751,7 @@ void refr_gradients_3d(Workspace& ws,
                        Numeric& dndlat,
                        Numeric& dndlon,
                        const Agenda& refr_index_air_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView lat_grid,
                        ConstVectorView lon_grid,
@@ -642,6 +767,7 @@ void refr_gradients_3d(Workspace& ws,
                     refr_index_air,
                     refr_index_air_group,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     lon_grid,
@@ -661,6 +787,7 @@ void refr_gradients_3d(Workspace& ws,
                     refr_index_air,
                     dummy,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     lon_grid,
@@ -681,6 +808,7 @@ void refr_gradients_3d(Workspace& ws,
                     refr_index_air,
                     dummy,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     lon_grid,
@@ -701,6 +829,7 @@ void refr_gradients_3d(Workspace& ws,
                     refr_index_air,
                     dummy,
                     refr_index_air_agenda,
+                    refr_index_air_field,
                     p_grid,
                     lat_grid,
                     lon_grid,
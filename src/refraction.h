@@ -31,6 +31,7 @@ void get_refr_index_1d(Workspace& ws,
                        Numeric& refr_index,
                        Numeric& refr_index_group,
                        const Agenda& refr_index_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView refellipsoid,
                        ConstTensor3View z_field,
@@ -43,6 +44,7 @@ void get_refr_index_2d(Workspace& ws,
                        Numeric& refr_index,
                        Numeric& refr_index_group,
                        const Agenda& refr_index_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView lat_grid,
                        ConstVectorView refellipsoid,
@@ -57,6 +59,7 @@ void get_refr_index_3d(Workspace& ws,
                        Numeric& refr_index,
                        Numeric& refr_index_group,
                        const Agenda& refr_index_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView lat_grid,
                        ConstVectorView lon_grid,
@@ -74,6 +77,7 @@ void refr_gradients_1d(Workspace& ws,
                        Numeric& refr_index_air_group,
                        Numeric& dndr,
                        const Agenda& refr_index_air_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView refellipsoid,
                        ConstTensor3View z_field,
@@ -88,6 +92,7 @@ void refr_gradients_2d(Workspace& ws,
                        Numeric& dndr,
                        Numeric& dndlat,
                        const Agenda& refr_index_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView lat_grid,
                        ConstVectorView refellipsoid,
@@ -105,6 +110,7 @@ void refr_gradients_3d(Workspace& ws,
                        Numeric& dndlat,
                        Numeric& dndlon,
                        const Agenda& refr_index_agenda,
+                       ConstTensor4View refr_index_air_field,
                        ConstVectorView p_grid,
                        ConstVectorView lat_grid,
                        ConstVectorView lon_grid,
@@ -16,6 +16,7 @@
 #include "arts_conversions.h"
 #include "auto_md.h"
 #include "check_input.h"
+#include "disort.h"
 #include "geodetic.h"
 #include "lin_alg.h"
 #include "logic.h"
@@ -25,6 +26,8 @@
 #include "ppath.h"
 #include "refraction.h"
 #include "special_interp.h"
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <stdexcept>
 
@@ -850,97 +853,79 @@ void get_ppath_atmvars(Vector& ppath_p,
   interpweights(itw_p, ppath.gp_p);
   itw2p(ppath_p, p_grid, ppath.gp_p, itw_p);
 
-  // Temperature:
-  ppath_t.resize(np);
+  // All other fields are interpolated together, sharing grid cell corners
+  // and weights. Fields are collected in the order: t, vmr, nlte, wind and
+  // magnetic field components.
   Matrix itw_field;
   interp_atmfield_gp2itw(
       itw_field, atmosphere_dim, ppath.gp_p, ppath.gp_lat, ppath.gp_lon);
-  interp_atmfield_by_itw(ppath_t,
+
+  const Index ns = vmr_field.nbooks();
+  const bool do_nlte = nlte_field.type != EnergyLevelMapType::None_t;
+  ARTS_USER_ERROR_IF(
+      do_nlte and nlte_field.type != EnergyLevelMapType::Tensor3_t,
+      "Must have Tensor3_t, input type is bad");
+  const Index nnlte = do_nlte ? nlte_field.levels.nelem() : 0;
+  const std::array<ConstTensor3View, 6> vec_fields{wind_u_field,
+                                                   wind_v_field,
+                                                   wind_w_field,
+                                                   mag_u_field,
+                                                   mag_v_field,
+                                                   mag_w_field};
+
+  Array<ConstTensor3View> fields;
+  fields.reserve(1 + ns + nnlte + vec_fields.size());
+  fields.push_back(t_field);
+  for (Index is = 0; is < ns; is++)
+    fields.push_back(vmr_field(is, joker, joker, joker));
+  for (Index il = 0; il < nnlte; il++)
+    fields.push_back(nlte_field.value(il, joker, joker, joker));
+  for (auto& f : vec_fields)
+    if (f.npages() > 0) fields.push_back(f);
+
+  Matrix ppath_x(fields.nelem(), np);
+  interp_atmfield_by_itw(ppath_x,
                          atmosphere_dim,
-                         t_field,
+                         fields,
                          ppath.gp_p,
                          ppath.gp_lat,
                          ppath.gp_lon,
                          itw_field);
 
+  Index ix = 0;
+
+  // Temperature:
+  ppath_t.resize(np);
+  ppath_t = ppath_x(ix++, joker);
+
   // VMR fields:
-  const Index ns = vmr_field.nbooks();
   ppath_vmr.resize(ns, np);
-  for (Index is = 0; is < ns; is++) {
-    interp_atmfield_by_itw(ppath_vmr(is, joker),
-                           atmosphere_dim,
-                           vmr_field(is, joker, joker, joker),
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
+  ppath_vmr = ppath_x(Range(ix, ns), joker);
+  ix += ns;
 
   // NLTE temperatures
-  ppath_nlte = nlte_field.InterpToGridPos(atmosphere_dim, ppath.gp_p, ppath.gp_lat, ppath.gp_lon);
+  if (do_nlte) {
+    ppath_nlte = EnergyLevelMap(
+        EnergyLevelMapType::Vector_t, 1, 1, np, nlte_field);
+    for (Index il = 0; il < nnlte; il++)
+      ppath_nlte.value(il, 0, 0, joker) = ppath_x(ix++, joker);
+  } else {
+    ppath_nlte = EnergyLevelMap{};
+  }
 
-  // Winds:
+  // Winds and magnetic field:
   ppath_wind.resize(3, np);
   ppath_wind = 0;
-  //
-  if (wind_u_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_wind(0, joker),
-                           atmosphere_dim,
-                           wind_u_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-  if (wind_v_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_wind(1, joker),
-                           atmosphere_dim,
-                           wind_v_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-  if (wind_w_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_wind(2, joker),
-                           atmosphere_dim,
-                           wind_w_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-
-  // Magnetic field:
   ppath_mag.resize(3, np);
   ppath_mag = 0;
   //
-  if (mag_u_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_mag(0, joker),
-                           atmosphere_dim,
-                           mag_u_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-  if (mag_v_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_mag(1, joker),
-                           atmosphere_dim,
-                           mag_v_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
-  }
-  if (mag_w_field.npages() > 0) {
-    interp_atmfield_by_itw(ppath_mag(2, joker),
-                           atmosphere_dim,
-                           mag_w_field,
-                           ppath.gp_p,
-                           ppath.gp_lat,
-                           ppath.gp_lon,
-                           itw_field);
+  for (Index i = 0; i < 6; i++) {
+    if (vec_fields[i].npages() > 0) {
+      if (i < 3)
+        ppath_wind(i, joker) = ppath_x(ix++, joker);
+      else
+        ppath_mag(i - 3, joker) = ppath_x(ix++, joker);
+    }
   }
 }
 
@@ -973,13 +958,14 @@ void get_ppath_cloudvars(ArrayOfIndex& clear2cloudy,
   // If outside cloudbox or all (d)pnd=0, this variable holds -1.
   clear2cloudy.resize(np);
 
-  // Determine ppath_pnd and ppath_dpnd_dx
-  Index nin = 0;
+  // Find points inside the cloudbox, and their cloudbox grid positions and
+  // interpolation weights
+  ArrayOfIndex ip_in;
+  ip_in.reserve(np);
+  ArrayOfGridPos gpc_p(np), gpc_lat(np), gpc_lon(np);
+  Matrix itw(np, Index(1) << atmosphere_dim);
   for (Index ip = 0; ip < np; ip++)  // PPath point
   {
-    Matrix itw(1, Index(pow(2.0, Numeric(atmosphere_dim))));
-
-    ArrayOfGridPos gpc_p(1), gpc_lat(1), gpc_lon(1);
     GridPos gp_lat, gp_lon;
     if (atmosphere_dim >= 2) {
       gridpos_copy(gp_lat, ppath.gp_lat[ip]);
@@ -988,62 +974,80 @@ void get_ppath_cloudvars(ArrayOfIndex& clear2cloudy,
       gridpos_copy(gp_lon, ppath.gp_lon[ip]);
     }
 
+    clear2cloudy[ip] = -1;
     if (is_gp_inside_cloudbox(ppath.gp_p[ip],
                               gp_lat,
                               gp_lon,
                               cloudbox_limits,
                               true,
                               atmosphere_dim)) {
-      interp_cloudfield_gp2itw(itw(0, joker),
-                               gpc_p[0],
-                               gpc_lat[0],
-                               gpc_lon[0],
+      const Index iin = ip_in.nelem();
+      interp_cloudfield_gp2itw(itw(iin, joker),
+                               gpc_p[iin],
+                               gpc_lat[iin],
+                               gpc_lon[iin],
                                ppath.gp_p[ip],
                                gp_lat,
                                gp_lon,
                                atmosphere_dim,
                                cloudbox_limits);
-      for (Index i = 0; i < pnd_field.nbooks(); i++) {
-        interp_atmfield_by_itw(ExhaustiveVectorView{ppath_pnd(i, ip)},
-                               atmosphere_dim,
-                               pnd_field(i, joker, joker, joker),
-                               gpc_p,
-                               gpc_lat,
-                               gpc_lon,
-                               itw);
+      ip_in.push_back(ip);
+    }
+  }
+
+  const Index nin = ip_in.nelem();
+  if (!nin) return;
+  gpc_p.resize(nin);
+  gpc_lat.resize(nin);
+  gpc_lon.resize(nin);
+
+  // Interpolate pnd and all dpnd in one go
+  const Index ne = pnd_field.nbooks();
+  Array<ConstTensor3View> fields;
+  for (Index i = 0; i < ne; i++)  // Scattering element
+    fields.push_back(pnd_field(i, joker, joker, joker));
+  if (any_dpnd) {
+    for (Index iq = 0; iq < dpnd_field_dx.nelem(); iq++)  // Jacobian parameter
+    {
+      if (!dpnd_field_dx[iq].empty()) {
+        for (Index i = 0; i < ne; i++)
+          fields.push_back(dpnd_field_dx[iq](i, joker, joker, joker));
       }
-      bool any_ppath_dpnd = false;
-      if (any_dpnd) {
-        for (Index iq = 0; iq < dpnd_field_dx.nelem();
-             iq++)  // Jacobian parameter
-        {
-          if (!dpnd_field_dx[iq].empty()) {
-            for (Index i = 0; i < pnd_field.nbooks();
-                 i++)  // Scattering element
-            {
-              interp_atmfield_by_itw(ExhaustiveVectorView{ppath_dpnd_dx[iq](i, ip)},
-                                     atmosphere_dim,
-                                     dpnd_field_dx[iq](i, joker, joker, joker),
-                                     gpc_p,
-                                     gpc_lat,
-                                     gpc_lon,
-                                     itw);
-            }
-            if (max(ppath_dpnd_dx[iq](joker, ip)) > 0. ||
-                min(ppath_dpnd_dx[iq](joker, ip)) < 0.)
-              any_ppath_dpnd = true;
-          }
+    }
+  }
+  //
+  Matrix x(fields.nelem(), nin);
+  interp_atmfield_by_itw(x,
+                         atmosphere_dim,
+                         fields,
+                         gpc_p,
+                         gpc_lat,
+                         gpc_lon,
+                         itw(Range(0, nin), joker));
+
+  // Sort out the result
+  Index ncloudy = 0;
+  for (Index iin = 0; iin < nin; iin++) {
+    const Index ip = ip_in[iin];
+    Index ix = 0;
+    ppath_pnd(joker, ip) = x(Range(ix, ne), iin);
+    ix += ne;
+    bool any_ppath_dpnd = false;
+    if (any_dpnd) {
+      for (Index iq = 0; iq < dpnd_field_dx.nelem(); iq++) {
+        if (!dpnd_field_dx[iq].empty()) {
+          ppath_dpnd_dx[iq](joker, ip) = x(Range(ix, ne), iin);
+          ix += ne;
+          if (max(ppath_dpnd_dx[iq](joker, ip)) > 0. ||
+              min(ppath_dpnd_dx[iq](joker, ip)) < 0.)
+            any_ppath_dpnd = true;
         }
       }
-      if (max(ppath_pnd(joker, ip)) > 0. || min(ppath_pnd(joker, ip)) < 0. ||
-          any_ppath_dpnd) {
-        clear2cloudy[ip] = nin;
-        nin++;
-      } else {
-        clear2cloudy[ip] = -1;
-      }
-    } else {
-      clear2cloudy[ip] = -1;
+    }
+    if (max(ppath_pnd(joker, ip)) > 0. || min(ppath_pnd(joker, ip)) < 0. ||
+        any_ppath_dpnd) {
+      clear2cloudy[ip] = ncloudy;
+      ncloudy++;
     }
   }
 }
@@ -1103,14 +1107,21 @@ void get_stepwise_blackbody_radiation(VectorView B,
                                       const ConstVectorView& ppath_f_grid,
                                       const Numeric& ppath_temperature,
                                       const bool& do_temperature_derivative) {
-  const Index nf = ppath_f_grid.nelem();
-
-  for (Index i = 0; i < nf; i++)
-    B[i] = planck(ppath_f_grid[i], ppath_temperature);
+  if (do_temperature_derivative)
+    planck(B, dB_dT, ppath_f_grid, ppath_temperature);
+  else
+    planck(B, ppath_f_grid, ppath_temperature);
+}
 
+void get_stepwise_blackbody_radiation(VectorView B,
+                                      VectorView dB_dT,
+                                      const PlanckFrequencyFactors& planck_f,
+                                      const Numeric& ppath_temperature,
+                                      const bool& do_temperature_derivative) {
   if (do_temperature_derivative)
-    for (Index i = 0; i < nf; i++)
-      dB_dT[i] = dplanck_dt(ppath_f_grid[i], ppath_temperature);
+    planck_f.planck(B, dB_dT, ppath_temperature);
+  else
+    planck_f.planck(B, ppath_temperature);
 }
 
 void get_stepwise_clearsky_propmat(
@@ -1151,6 +1162,192 @@ void get_stepwise_clearsky_propmat(
   lte = S.allZeroes();  // FIXME: Should be nlte_do?
 }
 
+namespace {
+thread_local PropmatClearskyCache* active_propmat_cache = nullptr;
+}  // namespace
+
+PropmatClearskyCache::Activate::Activate(PropmatClearskyCache* cache)
+    : previous(active_propmat_cache) {
+  active_propmat_cache = cache;
+}
+
+PropmatClearskyCache::Activate::~Activate() { active_propmat_cache = previous; }
+
+PropmatClearskyCache* PropmatClearskyCache::active() {
+  return active_propmat_cache;
+}
+
+Vector PropmatClearskyCache::key(const ConstVectorView& ppath_f_grid,
+                                 const ConstVectorView& ppath_magnetic_field,
+                                 const ConstVectorView& ppath_line_of_sight,
+                                 const EnergyLevelMap& ppath_nlte,
+                                 const ConstVectorView& ppath_vmrs,
+                                 const Numeric& ppath_temperature,
+                                 const Numeric& ppath_pressure,
+                                 const Index& nq) {
+  // The line-of-sight only matters for Zeeman effect
+  const bool do_los = std::any_of(ppath_magnetic_field.begin(),
+                                  ppath_magnetic_field.end(),
+                                  [](auto x) { return x != 0; });
+  const Index nlos = do_los ? ppath_line_of_sight.nelem() : 0;
+  const Index nnlte = ppath_nlte.value.size();
+
+  Vector k(3 + ppath_f_grid.nelem() + ppath_magnetic_field.nelem() + nlos +
+           nnlte + ppath_vmrs.nelem());
+  Index i = 0;
+  k[i++] = ppath_pressure;
+  k[i++] = ppath_temperature;
+  k[i++] = Numeric(nq);
+  for (auto x : ppath_f_grid) k[i++] = x;
+  for (auto x : ppath_magnetic_field) k[i++] = x;
+  for (Index j = 0; j < nlos; j++) k[i++] = ppath_line_of_sight[j];
+  for (auto x = ppath_nlte.value.elem_begin(); x != ppath_nlte.value.elem_end(); ++x)
+    k[i++] = *x;
+  for (auto x : ppath_vmrs) k[i++] = x;
+  return k;
+}
+
+namespace {
+std::size_t propmat_cache_hash(const Vector& key) {
+  std::size_t seed = key.size();
+  for (auto x : key)
+    seed ^= std::hash<Numeric>{}(x) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  return seed;
+}
+}  // namespace
+
+bool PropmatClearskyCache::get(PropagationMatrix& K,
+                               StokesVector& S,
+                               Index& lte,
+                               ArrayOfPropagationMatrix& dK_dx,
+                               ArrayOfStokesVector& dS_dx,
+                               const Vector& key) const {
+  const std::size_t h = propmat_cache_hash(key);
+
+  std::lock_guard lock{mtx};
+  const auto bucket = data.find(h);
+  if (bucket == data.end()) return false;
+
+  for (auto& e : bucket->second) {
+    if (e.key.size() == key.size() and
+        std::equal(e.key.begin(), e.key.end(), key.begin())) {
+      K = e.K;
+      S = e.S;
+      lte = e.lte;
+      dK_dx = e.dK_dx;
+      dS_dx = e.dS_dx;
+      return true;
+    }
+  }
+  return false;
+}
+
+void PropmatClearskyCache::set(const Vector& key,
+                               const PropagationMatrix& K,
+                               const StokesVector& S,
+                               const Index& lte,
+                               const ArrayOfPropagationMatrix& dK_dx,
+                               const ArrayOfStokesVector& dS_dx) {
+  const std::size_t h = propmat_cache_hash(key);
+
+  Index n = key.size() + K.Data().size() + S.Data().size();
+  for (auto& x : dK_dx) n += x.Data().size();
+  for (auto& x : dS_dx) n += x.Data().size();
+
+  std::lock_guard lock{mtx};
+  if (nnumerics + n > max_numerics) {
+    data.clear();
+    nentries = 0;
+    nnumerics = 0;
+  }
+
+  data[h].push_back(Entry{key, K, S, lte, dK_dx, dS_dx});
+  nentries++;
+  nnumerics += n;
+}
+
+void PropmatClearskyCache::clear() {
+  std::lock_guard lock{mtx};
+  data.clear();
+  nentries = 0;
+  nnumerics = 0;
+}
+
+Index PropmatClearskyCache::size() const {
+  std::lock_guard lock{mtx};
+  return nentries;
+}
+
+void get_stepwise_clearsky_propmat_cached(
+    Workspace& ws,
+    PropmatClearskyCache* cache,
+    PropagationMatrix& K,
+    StokesVector& S,
+    Index& lte,
+    ArrayOfPropagationMatrix& dK_dx,
+    ArrayOfStokesVector& dS_dx,
+    const Agenda& propmat_clearsky_agenda,
+    const ArrayOfRetrievalQuantity& jacobian_quantities,
+    const Vector& ppath_f_grid,
+    const Vector& ppath_magnetic_field,
+    const Vector& ppath_line_of_sight,
+    const EnergyLevelMap& ppath_nlte,
+    const Vector& ppath_vmrs,
+    const Numeric& ppath_temperature,
+    const Numeric& ppath_pressure,
+    const bool& jacobian_do) {
+  if (not cache) {
+    get_stepwise_clearsky_propmat(ws,
+                                  K,
+                                  S,
+                                  lte,
+                                  dK_dx,
+                                  dS_dx,
+                                  propmat_clearsky_agenda,
+                                  jacobian_quantities,
+                                  ppath_f_grid,
+                                  ppath_magnetic_field,
+                                  ppath_line_of_sight,
+                                  ppath_nlte,
+                                  ppath_vmrs,
+                                  ppath_temperature,
+                                  ppath_pressure,
+                                  jacobian_do);
+    return;
+  }
+
+  const Vector key =
+      PropmatClearskyCache::key(ppath_f_grid,
+                                ppath_magnetic_field,
+                                ppath_line_of_sight,
+                                ppath_nlte,
+                                ppath_vmrs,
+                                ppath_temperature,
+                                ppath_pressure,
+                                jacobian_do ? jacobian_quantities.nelem() : 0);
+
+  if (cache->get(K, S, lte, dK_dx, dS_dx, key)) return;
+
+  get_stepwise_clearsky_propmat(ws,
+                                K,
+                                S,
+                                lte,
+                                dK_dx,
+                                dS_dx,
+                                propmat_clearsky_agenda,
+                                jacobian_quantities,
+                                ppath_f_grid,
+                                ppath_magnetic_field,
+                                ppath_line_of_sight,
+                                ppath_nlte,
+                                ppath_vmrs,
+                                ppath_temperature,
+                                ppath_pressure,
+                                jacobian_do);
+
+  cache->set(key, K, S, lte, dK_dx, dS_dx);
+}
+
 Vector get_stepwise_f_partials(const ConstVectorView& line_of_sight,
                                const ConstVectorView& f_grid,
                                const Jacobian::Atm wind_type,
@@ -1643,12 +1840,19 @@ void iyb_calc(Workspace& ws,
 
     WorkspaceOmpParallelCopyGuard wss{ws};
 
+    // Caches owned by yCalc must be activated in each thread
+    PropmatClearskyCache* const propmat_cache = PropmatClearskyCache::active();
+    DisortLayerCache* const layer_cache = DisortLayerCache::active();
+
     // Start of actual calculations
 #pragma omp parallel for if (!arts_omp_in_parallel()) firstprivate(wss)
     for (Index ilos = 0; ilos < nlos; ilos++) {
       // Skip remaining iterations if an error occurred
       if (failed) continue;
 
+      const PropmatClearskyCache::Activate propmat_active{propmat_cache};
+      const DisortLayerCache::Activate layer_active{layer_cache};
+
       Ppath ppath;
       Vector geo_pos;
       iyb_calc_body(failed,
@@ -2241,14 +2445,7 @@ void yCalc_mblock_loop_body(bool& failed,
       // We set geo_pos based on the max value in sensor_response
       const Index nfs = f_grid.nelem() * stokes_dim;
       for (Index i = 0; i < n1y; i++) {
-        Index jmax = -1;
-        Numeric rmax = -99e99;
-        for (Index j = 0; j < sensor_response.ncols(); j++) {
-          if (sensor_response(i, j) > rmax) {
-            rmax = sensor_response(i, j);
-            jmax = j;
-          }
-        }
+        const Index jmax = sensor_response.row_argmax(i);
         const auto jhit = Index(floor(jmax / nfs));
         y_geo(row0 + i, joker) = geo_pos_matrix(jhit, joker);
       }
@@ -23,8 +23,13 @@
 #include "matpack_data.h"
 #include "matpack_complex.h"
 #include "optproperties.h"
+#include "physics_funcs.h"
 #include "ppath.h"
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 
 class Workspace;
 
@@ -475,6 +480,23 @@ void get_stepwise_blackbody_radiation(VectorView B,
                                       const Numeric& ppath_temperature,
                                       const bool& do_temperature_derivative);
 
+/** As above, but with the frequency factors of the Planck function given
+ *
+ * To be used when the frequency grid is the same for many points, e.g.
+ * when there are no winds.
+ *
+ * @param[in,out] B Blackbody radiation at propagation path point
+ * @param[in,out] dB_dT Blackbody radiation temperature derivative at propagation path point
+ * @param[in] planck_f Planck frequency factors of frequency grid at propagation path point
+ * @param[in] ppath_temperature Temperature of atmosphere at propagation path point
+ * @param[in] do_temperature_derivative Fill dB_dT?
+ */
+void get_stepwise_blackbody_radiation(VectorView B,
+                                      VectorView dB_dT,
+                                      const PlanckFrequencyFactors& planck_f,
+                                      const Numeric& ppath_temperature,
+                                      const bool& do_temperature_derivative);
+
 /** Gets the clearsky propgation matrix and NLTE contributions
  * 
  * Basically a wrapper for calls to the propagation clearsky agenda
@@ -517,6 +539,133 @@ void get_stepwise_clearsky_propmat(
     const Numeric& ppath_pressure,
     const bool& jacobian_do);
 
+/** Cache of clearsky propagation matrices
+ *
+ * Holds the output of *propmat_clearsky_agenda* keyed on the complete
+ * atmospheric state at a propagation path point, i.e. the wind-adjusted
+ * frequency grid, magnetic field, NLTE distribution, VMRs, temperature
+ * and pressure. The line-of-sight is only part of the key if the magnetic
+ * field is non-zero.
+ *
+ * The cache assumes that the absorption setup is not changed while it is
+ * in use. *yCalc* and *iyCalc* own a cache for the duration of the call,
+ * and make it available to the RT methods through Activate. The cache is
+ * also reset if it grows beyond max_numerics stored values.
+ *
+ * All members are thread-safe.
+ */
+class PropmatClearskyCache {
+ public:
+  /** Upper limit of the number of Numeric stored before a reset */
+  static constexpr Index max_numerics = 50'000'000;
+
+  /** Makes a cache the active one of the calling thread
+   *
+   * The previously active cache is restored when the object is destroyed.
+   * The setting is local to the thread, and OpenMP loops executing
+   * *iy_main_agenda* must activate the cache in each iteration.
+   */
+  class Activate {
+   public:
+    explicit Activate(PropmatClearskyCache* cache);
+    Activate(const Activate&) = delete;
+    Activate& operator=(const Activate&) = delete;
+    ~Activate();
+
+   private:
+    PropmatClearskyCache* previous;
+  };
+
+  /** The cache active in the calling thread, nullptr if there is none */
+  static PropmatClearskyCache* active();
+
+  /** Creates the cache key for a propagation path point
+   *
+   * @param[in] ppath_f_grid Wind-adjusted frequency grid at propagation path point
+   * @param[in] ppath_mag_field Magnetic field at propagation path point
+   * @param[in] ppath_line_of_sight Line of sight at propagation path point
+   * @param[in] ppath_nlte NLTE distribution at propagation path point
+   * @param[in] ppath_vmrs Volume mixing ratio of atmospheric species at propagation path point
+   * @param[in] ppath_temperature Temperature of atmosphere at propagation path point
+   * @param[in] ppath_pressure Pressure of atmosphere at propagation path point
+   * @param[in] nq Number of analytical Jacobian quantities
+   * @return The key
+   */
+  static Vector key(const ConstVectorView& ppath_f_grid,
+                    const ConstVectorView& ppath_magnetic_field,
+                    const ConstVectorView& ppath_line_of_sight,
+                    const EnergyLevelMap& ppath_nlte,
+                    const ConstVectorView& ppath_vmrs,
+                    const Numeric& ppath_temperature,
+                    const Numeric& ppath_pressure,
+                    const Index& nq);
+
+  /** Copies a cached entry to the output variables
+   *
+   * @return true if key was found, otherwise the output is untouched
+   */
+  bool get(PropagationMatrix& K,
+           StokesVector& S,
+           Index& lte,
+           ArrayOfPropagationMatrix& dK_dx,
+           ArrayOfStokesVector& dS_dx,
+           const Vector& key) const;
+
+  /** Adds a new entry to the cache */
+  void set(const Vector& key,
+           const PropagationMatrix& K,
+           const StokesVector& S,
+           const Index& lte,
+           const ArrayOfPropagationMatrix& dK_dx,
+           const ArrayOfStokesVector& dS_dx);
+
+  /** Removes all entries */
+  void clear();
+
+  /** Number of entries */
+  [[nodiscard]] Index size() const;
+
+ private:
+  struct Entry {
+    Vector key;
+    PropagationMatrix K;
+    StokesVector S;
+    Index lte;
+    ArrayOfPropagationMatrix dK_dx;
+    ArrayOfStokesVector dS_dx;
+  };
+
+  mutable std::mutex mtx;
+  std::unordered_map<std::size_t, std::vector<Entry>> data;
+  Index nentries{0};
+  Index nnumerics{0};
+};
+
+/** As get_stepwise_clearsky_propmat, but going through PropmatClearskyCache
+ *
+ * The agenda is only executed if the atmospheric state is not already
+ * found in the cache. New results are added to the cache. A nullptr
+ * cache gives the same as get_stepwise_clearsky_propmat.
+ */
+void get_stepwise_clearsky_propmat_cached(
+    Workspace& ws,
+    PropmatClearskyCache* cache,
+    PropagationMatrix& K,
+    StokesVector& S,
+    Index& lte,
+    ArrayOfPropagationMatrix& dK_dx,
+    ArrayOfStokesVector& dS_dx,
+    const Agenda& propmat_clearsky_agenda,
+    const ArrayOfRetrievalQuantity& jacobian_quantities,
+    const Vector& ppath_f_grid,
+    const Vector& ppath_magnetic_field,
+    const Vector& ppath_line_of_sight,
+    const EnergyLevelMap& ppath_nlte,
+    const Vector& ppath_vmrs,
+    const Numeric& ppath_temperature,
+    const Numeric& ppath_pressure,
+    const bool& jacobian_do);
+
 /** Computes the ratio that a partial derivative with regards to frequency
  *  relates to the wind of come component
  * 
@@ -14,12 +14,14 @@
   ===========================================================================*/
 
 #include "sensor.h"
+#include <algorithm>
 #include <cmath>
 #include <list>
 #include <stdexcept>
 #include "arts.h"
 #include "arts_constants.h"
 #include "arts_conversions.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "gridded_fields.h"
 #include "logic.h"
@@ -39,6 +41,56 @@ using GriddedFieldGrids::GFIELD4_F_GRID;
 using GriddedFieldGrids::GFIELD4_ZA_GRID;
 using GriddedFieldGrids::GFIELD4_AA_GRID;
 
+namespace {
+/** Collects the rows of a sparse matrix before they are inserted.
+ *
+ * Rows can be set in any order, and from several threads as long as each
+ * row is set by a single thread. Only the non-zero elements are kept, as in
+ * Sparse::insert_row, but without building a dense row of full length.
+ */
+class SparseRows {
+ public:
+  explicit SparseRows(const Index nrows) : cols(nrows), values(nrows) {}
+
+  /** Sets row r to x, placed at every stride:th column starting at col0. */
+  void set(const Index r,
+           const Index col0,
+           const Index stride,
+           ConstVectorView x) {
+    cols[r].clear();
+    values[r].clear();
+    for (Index i = 0; i < x.nelem(); i++) {
+      if (x[i] != 0) {
+        cols[r].push_back(col0 + i * stride);
+        values[r].push_back(x[i]);
+      }
+    }
+  }
+
+  /** Inserts all rows into H, that must be empty and of matching size. */
+  void insert(Sparse& H) const {
+    Index nnz = 0;
+    for (const auto& c : cols) nnz += c.nelem();
+
+    ArrayOfIndex rowind(nnz), colind(nnz);
+    Vector data(nnz);
+    Index j = 0;
+    for (Index r = 0; r < cols.nelem(); r++) {
+      for (Index i = 0; i < cols[r].nelem(); i++, j++) {
+        rowind[j] = r;
+        colind[j] = cols[r][i];
+        data[j] = values[r][i];
+      }
+    }
+    H.insert_elements(nnz, rowind, colind, data);
+  }
+
+ private:
+  ArrayOfArrayOfIndex cols;
+  Array<ArrayOfNumeric> values;
+};
+}  // namespace
+
 /*===========================================================================
   === The functions, besides the core integration and sum functions that are
   === placed together at the end
@@ -99,88 +151,107 @@ void antenna1d_matrix(Sparse& H,
   // Resize H
   H.resize(n_ant * nfpol, n_za * nfpol);
 
-  // Storage vectors for response weights
-  Vector hrow(H.ncols(), 0.0);
-  Vector hza(n_za, 0.0);
+  // A pattern without frequency and polarisation variation gives the same
+  // weights for all frequencies of a beam, that then are handled together.
+  // Otherwise beams and frequencies are handled in parallel.
+  const bool same_weights = n_ar_f == 1 && !pol_step;
+  const Index f_step = same_weights ? n_f : 1;
+  const Index n_fpart = same_weights ? std::min(n_f, Index{1}) : n_f;
 
-  // Antenna response to apply (possibly obtained by frequency interpolation)
-  Vector aresponse(n_ar_za, 0.0);
+  SparseRows rows(n_ant * nfpol);
 
-  // Antenna beam loop
-  for (Index ia = 0; ia < n_ant; ia++) {
-    Vector shifted_aresponse_za_grid{aresponse_za_grid};
-    shifted_aresponse_za_grid += antenna_dza[ia];
+  // One message per iteration, the lowest index is reported
+  ArrayOfString fail_msg(n_ant * n_fpart);
 
-    // Order of loops assumes that the antenna response more often
-    // changes with frequency than for polarisation
+#pragma omp parallel for if (!arts_omp_in_parallel() && n_ant * n_fpart > 1)
+  for (Index iaf = 0; iaf < n_ant * n_fpart; iaf++) {
+    try {
+      const Index ia = iaf / n_fpart;
+      const Index f0 = (iaf % n_fpart) * f_step;
 
-    // Frequency loop
-    for (Index f = 0; f < n_f; f++) {
-      // Polarisation loop
-      for (Index ip = 0; ip < n_pol; ip++) {
-        // Determine antenna pattern to apply
-        //
-        // Interpolation needed only if response has a frequency grid
-        //
-        Index new_antenna = 1;
-        //
-        if (n_ar_f == 1)  // No frequency variation
-        {
-          if (pol_step)  // Polarisation variation, update always needed
-          {
-            aresponse = antenna_response.data(ip, 0, joker, 0);
-          } else if (f == 0 && ip == 0)  // Set fully constant pattern
-          {
-            aresponse = antenna_response.data(0, 0, joker, 0);
-          } else  // The one set just above can be reused
-          {
-            new_antenna = 0;
-          }
-        } else {
-          if (ip == 0 || pol_step)  // Interpolation required
-          {
-            // Interpolation (do this in "green way")
-            ArrayOfGridPos gp_f(1), gp_za(n_ar_za);
-            gridpos(gp_f, aresponse_f_grid, Vector(1, f_grid[f]));
-            gridpos(gp_za, aresponse_za_grid, aresponse_za_grid);
-            Tensor3 itw(1, n_ar_za, 4);
-            interpweights(itw, gp_f, gp_za);
-            Matrix aresponse_matrix(1, n_ar_za);
-            interp(aresponse_matrix,
-                   itw,
-                   antenna_response.data(ip, joker, joker, 0),
-                   gp_f,
-                   gp_za);
-            aresponse = aresponse_matrix(0, joker);
-          } else  // Reuse pattern for ip==0
+      // Storage vector for response weights
+      Vector hza(n_za, 0.0);
+
+      // Antenna response to apply (possibly obtained by frequency
+      // interpolation)
+      Vector aresponse(n_ar_za, 0.0);
+
+      Vector shifted_aresponse_za_grid{aresponse_za_grid};
+      shifted_aresponse_za_grid += antenna_dza[ia];
+
+      // Order of loops assumes that the antenna response more often
+      // changes with frequency than for polarisation
+
+      // Frequency loop
+      for (Index f = f0; f < f0 + f_step; f++) {
+        // Polarisation loop
+        for (Index ip = 0; ip < n_pol; ip++) {
+          // Determine antenna pattern to apply
+          //
+          // Interpolation needed only if response has a frequency grid
+          //
+          Index new_antenna = 1;
+          //
+          if (n_ar_f == 1)  // No frequency variation
           {
-            new_antenna = 0;
+            if (pol_step)  // Polarisation variation, update always needed
+            {
+              aresponse = antenna_response.data(ip, 0, joker, 0);
+            } else if (f == f0 && ip == 0)  // Set fully constant pattern
+            {
+              aresponse = antenna_response.data(0, 0, joker, 0);
+            } else  // The one set just above can be reused
+            {
+              new_antenna = 0;
+            }
+          } else {
+            if (ip == 0 || pol_step)  // Interpolation required
+            {
+              // Interpolation (do this in "green way")
+              ArrayOfGridPos gp_f(1), gp_za(n_ar_za);
+              gridpos(gp_f, aresponse_f_grid, Vector(1, f_grid[f]));
+              gridpos(gp_za, aresponse_za_grid, aresponse_za_grid);
+              Tensor3 itw(1, n_ar_za, 4);
+              interpweights(itw, gp_f, gp_za);
+              Matrix aresponse_matrix(1, n_ar_za);
+              interp(aresponse_matrix,
+                     itw,
+                     antenna_response.data(ip, joker, joker, 0),
+                     gp_f,
+                     gp_za);
+              aresponse = aresponse_matrix(0, joker);
+            } else  // Reuse pattern for ip==0
+            {
+              new_antenna = 0;
+            }
           }
-        }
 
-        // Calculate response weights
-        if (new_antenna) {
-          integration_func_by_vecmult(
-              hza, aresponse, shifted_aresponse_za_grid, za_grid);
+          // Calculate response weights
+          if (new_antenna) {
+            integration_func_by_vecmult(
+                hza, aresponse, shifted_aresponse_za_grid, za_grid);
 
-          // Normalisation?
-          if (do_norm) {
-            hza /= sum(hza);
+            // Normalisation?
+            if (do_norm) {
+              hza /= sum(hza);
+            }
           }
-        }
 
-        // Put weights into H
-        //
-        const Index ii = f * n_pol + ip;
-        //
-        hrow[Range(ii, n_za, nfpol)] = hza;
-        //
-        H.insert_row(ia * nfpol + ii, hrow);
-        //
-        hrow = 0;
+          // Put weights into H
+          //
+          const Index ii = f * n_pol + ip;
+          //
+          rows.set(ia * nfpol + ii, ii, nfpol, hza);
+        }
       }
+    } catch (const std::exception& e) {
+      fail_msg[iaf] = e.what();
     }
   }
+
+  for (const auto& msg : fail_msg) ARTS_USER_ERROR_IF(msg.nelem(), msg);
+
+  rows.insert(H);
 }
 
 
@@ -284,145 +355,163 @@ void antenna2d_gridded_dlos(Sparse& H,
   // Resize H
   H.resize(n_ant * nfpol, n_dlos * nfpol);
 
-  // Storage vectors for response weights
-  Vector hrow(H.ncols(), 0.0);
-  Vector hza(n_dlos, 0.0);
+  // See antenna1d_matrix for how the beams and frequencies are shared
+  // between threads
+  const bool same_weights = n_ar_f == 1 && !pol_step;
+  const Index f_step = same_weights ? n_f : 1;
+  const Index n_fpart = same_weights ? std::min(n_f, Index{1}) : n_f;
 
-  // Antenna response to apply (possibly obtained by frequency interpolation)
-  Matrix aresponse(n_ar_za, n_ar_aa, 0.0);
-  
-  // Antenna beam loop
-  for (Index ia = 0; ia < n_ant; ia++) {
-    // Order of loops assumes that the antenna response more often
-    // changes with frequency than for polarisation
-
-    // Frequency loop
-    for (Index f = 0; f < n_f; f++) {
-      // Polarisation loop
-      for (Index ip = 0; ip < n_pol; ip++) {
-        // Determine antenna pattern to apply
-        //
-        // Interpolation needed only if response has a frequency grid
-        //
-        Index new_antenna = 1;
-        //
-        if (n_ar_f == 1)  // No frequency variation
-        {
-          if (pol_step)  // Polarisation variation, update always needed
-          {
-            aresponse = aresponse_with_cos(ip, 0, joker, joker);
-          } else if (f == 0 && ip == 0)  // Set fully constant pattern
-          {
-            aresponse = aresponse_with_cos(0, 0, joker, joker);
-          } else  // The one set just above can be reused
-          {
-            new_antenna = 0;
-          }
-        } else {
-          if (ip == 0 || pol_step) {
-            // Interpolation (do this in "green way")
-            ArrayOfGridPos gp_f(1), gp_za(n_ar_za), gp_aa(n_ar_aa);
-            gridpos(gp_f, aresponse_f_grid, Vector(1, f_grid[f]));
-            gridpos(gp_za, aresponse_za_grid, aresponse_za_grid);
-            gridpos(gp_aa, aresponse_aa_grid, aresponse_aa_grid);
-            Tensor4 itw(1, n_ar_za, n_ar_aa, 8);
-            interpweights(itw, gp_f, gp_za, gp_aa);
-            Tensor3 aresponse_matrix(1, n_ar_za, n_ar_aa);
-            interp(aresponse_matrix,
-                   itw,
-                   aresponse_with_cos(ip, joker, joker, joker),
-                   gp_f,
-                   gp_za,
-                   gp_aa);
-            aresponse = aresponse_matrix(0, joker, joker);
-          } else  // Reuse pattern for ip==0
+  SparseRows rows(n_ant * nfpol);
+
+  // One message per iteration, the lowest index is reported
+  ArrayOfString fail_msg(n_ant * n_fpart);
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n_ant * n_fpart > 1)
+  for (Index iaf = 0; iaf < n_ant * n_fpart; iaf++) {
+    try {
+      const Index ia = iaf / n_fpart;
+      const Index f0 = (iaf % n_fpart) * f_step;
+
+      // Storage vector for response weights
+      Vector hza(n_dlos, 0.0);
+
+      // Antenna response to apply (possibly obtained by frequency
+      // interpolation)
+      Matrix aresponse(n_ar_za, n_ar_aa, 0.0);
+
+      // Order of loops assumes that the antenna response more often
+      // changes with frequency than for polarisation
+
+      // Frequency loop
+      for (Index f = f0; f < f0 + f_step; f++) {
+        // Polarisation loop
+        for (Index ip = 0; ip < n_pol; ip++) {
+          // Determine antenna pattern to apply
+          //
+          // Interpolation needed only if response has a frequency grid
+          //
+          Index new_antenna = 1;
+          //
+          if (n_ar_f == 1)  // No frequency variation
           {
-            new_antenna = 0;
+            if (pol_step)  // Polarisation variation, update always needed
+            {
+              aresponse = aresponse_with_cos(ip, 0, joker, joker);
+            } else if (f == f0 && ip == 0)  // Set fully constant pattern
+            {
+              aresponse = aresponse_with_cos(0, 0, joker, joker);
+            } else  // The one set just above can be reused
+            {
+              new_antenna = 0;
+            }
+          } else {
+            if (ip == 0 || pol_step) {
+              // Interpolation (do this in "green way")
+              ArrayOfGridPos gp_f(1), gp_za(n_ar_za), gp_aa(n_ar_aa);
+              gridpos(gp_f, aresponse_f_grid, Vector(1, f_grid[f]));
+              gridpos(gp_za, aresponse_za_grid, aresponse_za_grid);
+              gridpos(gp_aa, aresponse_aa_grid, aresponse_aa_grid);
+              Tensor4 itw(1, n_ar_za, n_ar_aa, 8);
+              interpweights(itw, gp_f, gp_za, gp_aa);
+              Tensor3 aresponse_matrix(1, n_ar_za, n_ar_aa);
+              interp(aresponse_matrix,
+                     itw,
+                     aresponse_with_cos(ip, joker, joker, joker),
+                     gp_f,
+                     gp_za,
+                     gp_aa);
+              aresponse = aresponse_matrix(0, joker, joker);
+            } else  // Reuse pattern for ip==0
+            {
+              new_antenna = 0;
+            }
           }
-        }
 
-        // Calculate response weights, by using grid positions and "itw"
-        if (new_antenna) {
+          // Calculate response weights, by using grid positions and "itw"
+          if (new_antenna) {
           
-          // za grid positions
-          Vector zas{aresponse_za_grid};
-          zas += antenna_dlos(ia, 0);
-          ARTS_USER_ERROR_IF( zas[0] < za_grid[0],
-              "The zenith angle grid in *mblock_dlos* is too narrow. " 
-              "It must be extended downwards with at least ",
-              za_grid[0]-zas[0], " deg.")
-          ARTS_USER_ERROR_IF( zas[n_ar_za-1] > za_grid[nza-1],
-              "The zenith angle grid in *mblock_dlos* is too narrow. " 
-              "It must be extended upwards with at least ",
-              zas[n_ar_za-1] - za_grid[nza-1], " deg.")
+            // za grid positions
+            Vector zas{aresponse_za_grid};
+            zas += antenna_dlos(ia, 0);
+            ARTS_USER_ERROR_IF( zas[0] < za_grid[0],
+                "The zenith angle grid in *mblock_dlos* is too narrow. " 
+                "It must be extended downwards with at least ",
+                za_grid[0]-zas[0], " deg.")
+            ARTS_USER_ERROR_IF( zas[n_ar_za-1] > za_grid[nza-1],
+                "The zenith angle grid in *mblock_dlos* is too narrow. " 
+                "It must be extended upwards with at least ",
+                zas[n_ar_za-1] - za_grid[nza-1], " deg.")
           
-          ArrayOfGridPos gp_za(n_ar_za);
-          gridpos(gp_za, za_grid, zas);
+            ArrayOfGridPos gp_za(n_ar_za);
+            gridpos(gp_za, za_grid, zas);
           
-          // aa grid positions
-          Vector aas{aresponse_aa_grid};
-          if (antenna_dlos.ncols() > 1) { aas += antenna_dlos(ia, 1); }              
-          ARTS_USER_ERROR_IF( aas[0] < aa_grid[0],
-              "The azimuth angle grid in *mblock_dlos* is too narrow. " 
-              "It must be extended downwards with at least ",
-              aa_grid[0]-aas[0], " deg.")
-          ARTS_USER_ERROR_IF( aas[n_ar_aa-1] > aa_grid[naa-1],
-              "The azimuth angle grid in *mblock_dlos* is too narrow. " 
-              "It must be extended upwards with at least ",
-              aas[n_ar_aa-1] - aa_grid[naa-1], " deg.")
+            // aa grid positions
+            Vector aas{aresponse_aa_grid};
+            if (antenna_dlos.ncols() > 1) { aas += antenna_dlos(ia, 1); }              
+            ARTS_USER_ERROR_IF( aas[0] < aa_grid[0],
+                "The azimuth angle grid in *mblock_dlos* is too narrow. " 
+                "It must be extended downwards with at least ",
+                aa_grid[0]-aas[0], " deg.")
+            ARTS_USER_ERROR_IF( aas[n_ar_aa-1] > aa_grid[naa-1],
+                "The azimuth angle grid in *mblock_dlos* is too narrow. " 
+                "It must be extended upwards with at least ",
+                aas[n_ar_aa-1] - aa_grid[naa-1], " deg.")
           
-          ArrayOfGridPos gp_aa(n_ar_aa);
-          gridpos(gp_aa, aa_grid, aas);
+            ArrayOfGridPos gp_aa(n_ar_aa);
+            gridpos(gp_aa, aa_grid, aas);
 
 
-          // Derive interpolation weights
-          Tensor3 itw(n_ar_za, n_ar_za, 4);
-          interpweights(itw, gp_za, gp_aa);
+            // Derive interpolation weights
+            Tensor3 itw(n_ar_za, n_ar_za, 4);
+            interpweights(itw, gp_za, gp_aa);
 
-          // Convert iwt to weights for H
-          //
-          hza = 0;   // Note that values in hza must be accumulated 
-          //
-          for (Index iaa = 0; iaa < n_ar_aa; iaa++) {
-            const Index a = gp_aa[iaa].idx;
-            const Index b = a + 1;
+            // Convert iwt to weights for H
+            //
+            hza = 0;   // Note that values in hza must be accumulated 
+            //
+            for (Index iaa = 0; iaa < n_ar_aa; iaa++) {
+              const Index a = gp_aa[iaa].idx;
+              const Index b = a + 1;
             
-            for (Index iza = 0; iza < n_ar_za; iza++) {          
-
-              const Index z = gp_za[iza].idx;
-              const Index x = z + 1;
-
-              if( itw(iza,iaa,0) > 1e-9 ) {
-                hza[a*nza+z] += aresponse(iza,iaa) * itw(iza,iaa,0);
-              }
-              if( itw(iza,iaa,1) > 1e-9 ) {
-                hza[b*nza+z] += aresponse(iza,iaa) * itw(iza,iaa,1);
-              }
-              if( itw(iza,iaa,2) > 1e-9 ) {
-                hza[a*nza+x] += aresponse(iza,iaa) * itw(iza,iaa,2);
-              }
-              if( itw(iza,iaa,3) > 1e-9 ) {
-                hza[b*nza+x] += aresponse(iza,iaa) * itw(iza,iaa,3);
+              for (Index iza = 0; iza < n_ar_za; iza++) {          
+
+                const Index z = gp_za[iza].idx;
+                const Index x = z + 1;
+
+                if( itw(iza,iaa,0) > 1e-9 ) {
+                  hza[a*nza+z] += aresponse(iza,iaa) * itw(iza,iaa,0);
+                }
+                if( itw(iza,iaa,1) > 1e-9 ) {
+                  hza[b*nza+z] += aresponse(iza,iaa) * itw(iza,iaa,1);
+                }
+                if( itw(iza,iaa,2) > 1e-9 ) {
+                  hza[a*nza+x] += aresponse(iza,iaa) * itw(iza,iaa,2);
+                }
+                if( itw(iza,iaa,3) > 1e-9 ) {
+                  hza[b*nza+x] += aresponse(iza,iaa) * itw(iza,iaa,3);
+                }
               }
             }
+
+            // For 2D antennas we always normalise
+            hza /= sum(hza);
           }
 
-          // For 2D antennas we always normalise
-          hza /= sum(hza);
+          // Put weights into H
+          //
+          const Index ii = f * n_pol + ip;
+          //
+          rows.set(ia * nfpol + ii, ii, nfpol, hza);
         }
-
-        // Put weights into H
-        //
-        const Index ii = f * n_pol + ip;
-        //
-        hrow[Range(ii, n_dlos, nfpol)] = hza;
-        //
-        H.insert_row(ia * nfpol + ii, hrow);
-        //
-        hrow = 0;
       }
+    } catch (const std::exception& e) {
+      fail_msg[iaf] = e.what();
     }
-  }  
+  }
+
+  for (const auto& msg : fail_msg) ARTS_USER_ERROR_IF(msg.nelem(), msg);
+
+  rows.insert(H);
 }
 
 
@@ -497,115 +586,133 @@ void antenna2d_interp_response(Sparse& H,
   // Resize H
   H.resize(n_ant * nfpol, n_dlos * nfpol);
 
-  // Storage vectors for response weights
-  Vector hrow(H.ncols(), 0.0);
-  Vector hdlos(n_dlos, 0.0);
+  // See antenna1d_matrix for how the beams and frequencies are shared
+  // between threads
+  const bool same_weights = n_ar_f == 1 && !pol_step;
+  const Index f_step = same_weights ? n_f : 1;
+  const Index n_fpart = same_weights ? std::min(n_f, Index{1}) : n_f;
 
-  // Antenna response to apply (possibly obtained by frequency interpolation)
-  Matrix aresponse(n_ar_za, n_ar_aa, 0.0);
+  SparseRows rows(n_ant * nfpol);
 
   // If you find a bug or change something, likely also change other 2D antenna
   // function(s) as they are similar
 
-  // Antenna beam loop
-  for (Index ia = 0; ia < n_ant; ia++) {
-    // Order of loops assumes that the antenna response more often
-    // changes with frequency than for polarisation
+  // One message per iteration, the lowest index is reported
+  ArrayOfString fail_msg(n_ant * n_fpart);
 
-    // Frequency loop
-    for (Index f = 0; f < n_f; f++) {
-      // Polarisation loop
-      for (Index ip = 0; ip < n_pol; ip++) {
-        // Determine antenna pattern to apply
-        //
-        // Interpolation needed only if response has a frequency grid
-        //
-        Index new_antenna = 1;
-        //
-        if (n_ar_f == 1)  // No frequency variation
-        {
-          if (pol_step)  // Polarisation variation, update always needed
-          {
-            aresponse = antenna_response.data(ip, 0, joker, joker);
-          } else if (f == 0 && ip == 0)  // Set fully constant pattern
-          {
-            aresponse = antenna_response.data(0, 0, joker, joker);
-          } else  // The one set just above can be reused
-          {
-            new_antenna = 0;
-          }
-        } else {
-          if (ip == 0 || pol_step) {
-            // Interpolation (do this in "green way")
-            ArrayOfGridPos gp_f(1), gp_za(n_ar_za), gp_aa(n_ar_aa);
-            gridpos(gp_f, aresponse_f_grid, Vector(1, f_grid[f]));
-            gridpos(gp_za, aresponse_za_grid, aresponse_za_grid);
-            gridpos(gp_aa, aresponse_aa_grid, aresponse_aa_grid);
-            Tensor4 itw(1, n_ar_za, n_ar_aa, 8);
-            interpweights(itw, gp_f, gp_za, gp_aa);
-            Tensor3 aresponse_matrix(1, n_ar_za, n_ar_aa);
-            interp(aresponse_matrix,
-                   itw,
-                   antenna_response.data(ip, joker, joker, joker),
-                   gp_f,
-                   gp_za,
-                   gp_aa);
-            aresponse = aresponse_matrix(0, joker, joker);
-          } else  // Reuse pattern for ip==0
-          {
-            new_antenna = 0;
-          }
-        }
+#pragma omp parallel for if (!arts_omp_in_parallel() && n_ant * n_fpart > 1)
+  for (Index iaf = 0; iaf < n_ant * n_fpart; iaf++) {
+    try {
+      const Index ia = iaf / n_fpart;
+      const Index f0 = (iaf % n_fpart) * f_step;
 
-        // Calculate response weights
-        if (new_antenna) {
-          for (Index l = 0; l < n_dlos; l++) {
-            const Numeric za = mblock_dlos(l, 0) - antenna_dlos(ia, 0);
-            Numeric aa = 0.0;
-            if (mblock_dlos.ncols() > 1) {
-              aa += mblock_dlos(l, 1);
+      // Storage vector for response weights
+      Vector hdlos(n_dlos, 0.0);
+
+      // Antenna response to apply (possibly obtained by frequency
+      // interpolation)
+      Matrix aresponse(n_ar_za, n_ar_aa, 0.0);
+
+      // Order of loops assumes that the antenna response more often
+      // changes with frequency than for polarisation
+
+      // Frequency loop
+      for (Index f = f0; f < f0 + f_step; f++) {
+        // Polarisation loop
+        for (Index ip = 0; ip < n_pol; ip++) {
+          // Determine antenna pattern to apply
+          //
+          // Interpolation needed only if response has a frequency grid
+          //
+          Index new_antenna = 1;
+          //
+          if (n_ar_f == 1)  // No frequency variation
+          {
+            if (pol_step)  // Polarisation variation, update always needed
+            {
+              aresponse = antenna_response.data(ip, 0, joker, joker);
+            } else if (f == f0 && ip == 0)  // Set fully constant pattern
+            {
+              aresponse = antenna_response.data(0, 0, joker, joker);
+            } else  // The one set just above can be reused
+            {
+              new_antenna = 0;
             }
-            if (antenna_dlos.ncols() > 1) {
-              aa -= antenna_dlos(ia, 1);
+          } else {
+            if (ip == 0 || pol_step) {
+              // Interpolation (do this in "green way")
+              ArrayOfGridPos gp_f(1), gp_za(n_ar_za), gp_aa(n_ar_aa);
+              gridpos(gp_f, aresponse_f_grid, Vector(1, f_grid[f]));
+              gridpos(gp_za, aresponse_za_grid, aresponse_za_grid);
+              gridpos(gp_aa, aresponse_aa_grid, aresponse_aa_grid);
+              Tensor4 itw(1, n_ar_za, n_ar_aa, 8);
+              interpweights(itw, gp_f, gp_za, gp_aa);
+              Tensor3 aresponse_matrix(1, n_ar_za, n_ar_aa);
+              interp(aresponse_matrix,
+                     itw,
+                     antenna_response.data(ip, joker, joker, joker),
+                     gp_f,
+                     gp_za,
+                     gp_aa);
+              aresponse = aresponse_matrix(0, joker, joker);
+            } else  // Reuse pattern for ip==0
+            {
+              new_antenna = 0;
             }
+          }
 
-            // The response is zero if mblock_dlos is outside of
-            // antennna pattern
-            if (za < aresponse_za_grid[0] ||
-                za > aresponse_za_grid[n_ar_za - 1] ||
-                aa < aresponse_aa_grid[0] ||
-                aa > aresponse_aa_grid[n_ar_aa - 1]) {
-              hdlos[l] = 0;
-            }
-            // Otherwise we make an (blue) interpolation
-            else {
-              ArrayOfGridPos gp_za(1), gp_aa(1);
-              gridpos(gp_za, aresponse_za_grid, Vector(1, za));
-              gridpos(gp_aa, aresponse_aa_grid, Vector(1, aa));
-              Matrix itw(1, 4);
-              interpweights(itw, gp_za, gp_aa);
-              Vector value(1);
-              interp(value, itw, aresponse, gp_za, gp_aa);
-              hdlos[l] = solid_angles[l] * value[0];
+          // Calculate response weights
+          if (new_antenna) {
+            for (Index l = 0; l < n_dlos; l++) {
+              const Numeric za = mblock_dlos(l, 0) - antenna_dlos(ia, 0);
+              Numeric aa = 0.0;
+              if (mblock_dlos.ncols() > 1) {
+                aa += mblock_dlos(l, 1);
+              }
+              if (antenna_dlos.ncols() > 1) {
+                aa -= antenna_dlos(ia, 1);
+              }
+
+              // The response is zero if mblock_dlos is outside of
+              // antennna pattern
+              if (za < aresponse_za_grid[0] ||
+                  za > aresponse_za_grid[n_ar_za - 1] ||
+                  aa < aresponse_aa_grid[0] ||
+                  aa > aresponse_aa_grid[n_ar_aa - 1]) {
+                hdlos[l] = 0;
+              }
+              // Otherwise we make an (blue) interpolation
+              else {
+                ArrayOfGridPos gp_za(1), gp_aa(1);
+                gridpos(gp_za, aresponse_za_grid, Vector(1, za));
+                gridpos(gp_aa, aresponse_aa_grid, Vector(1, aa));
+                Matrix itw(1, 4);
+                interpweights(itw, gp_za, gp_aa);
+                Vector value(1);
+                interp(value, itw, aresponse, gp_za, gp_aa);
+                hdlos[l] = solid_angles[l] * value[0];
+              }
             }
+
+            // For 2D antennas we always normalise
+            hdlos /= sum(hdlos);
           }
 
-          // For 2D antennas we always normalise
-          hdlos /= sum(hdlos);
+          // Put weights into H
+          //
+          const Index ii = f * n_pol + ip;
+          //
+          rows.set(ia * nfpol + ii, ii, nfpol, hdlos);
         }
-
-        // Put weights into H
-        //
-        const Index ii = f * n_pol + ip;
-        //
-        hrow[Range(ii, n_dlos, nfpol)] = hdlos;
-        //
-        H.insert_row(ia * nfpol + ii, hrow);
-        //
-        hrow = 0;
       }
+    } catch (const std::exception& e) {
+      fail_msg[iaf] = e.what();
     }
   }
+
+  for (const auto& msg : fail_msg) ARTS_USER_ERROR_IF(msg.nelem(), msg);
+
+  rows.insert(H);
 }
 
 
@@ -682,31 +789,45 @@ void mixer_matrix(Sparse& H,
   // Calculate the sensor summation vector and insert the values in the
   // final matrix taking number of polarisations and zenith angles into
   // account.
-  Vector row_temp(f_grid.nelem());
-  Vector row_final(f_grid.nelem() * n_pol * n_sp);
+  SparseRows rows(H.nrows());
+  // One message per iteration, the lowest index is reported
+  ArrayOfString fail_msg(f_mixer.nelem());
   //
   Vector if_grid{f_grid};
   if_grid -= lo;
   //
+#pragma omp parallel for if (!arts_omp_in_parallel() && f_mixer.nelem() > 1)
   for (Index i = 0; i < f_mixer.nelem(); i++) {
-    summation_by_vecmult(
-        row_temp, filter.data, filter_grid, if_grid, f_mixer[i], -f_mixer[i]);
-
-    // Normalise if flag is set
-    if (do_norm) row_temp /= sum(row_temp);
-
-    // Loop over number of polarisations
-    for (Index p = 0; p < n_pol; p++) {
-      // Loop over number of zenith angles/antennas
-      for (Index a = 0; a < n_sp; a++) {
-        // Distribute elements of row_temp to row_final.
-        row_final = 0.0;
-        row_final[Range(
-            a * f_grid.nelem() * n_pol + p, f_grid.nelem(), n_pol)] = row_temp;
-        H.insert_row(a * f_mixer.nelem() * n_pol + p + i * n_pol, row_final);
+    try {
+      Vector row_temp(f_grid.nelem());
+      summation_by_vecmult(row_temp,
+                           filter.data,
+                           filter_grid,
+                           if_grid,
+                           f_mixer[i],
+                           -f_mixer[i]);
+
+      // Normalise if flag is set
+      if (do_norm) row_temp /= sum(row_temp);
+
+      // Loop over number of polarisations
+      for (Index p = 0; p < n_pol; p++) {
+        // Loop over number of zenith angles/antennas
+        for (Index a = 0; a < n_sp; a++) {
+          rows.set(a * f_mixer.nelem() * n_pol + p + i * n_pol,
+                   a * f_grid.nelem() * n_pol + p,
+                   n_pol,
+                   row_temp);
+        }
       }
+    } catch (const std::exception& x) {
+      fail_msg[i] = x.what();
     }
   }
+
+  for (const auto& msg : fail_msg) ARTS_USER_ERROR_IF(msg.nelem(), msg);
+
+  rows.insert(H);
 }
 
 
@@ -935,42 +1056,48 @@ void spectrometer_matrix(Sparse& H,
   //
   H.resize(nout, nin);
 
-  // Calculate the sensor integration vector and put values in the temporary
-  // vector, then copy vector to the transfer matrix
+  // Calculate the sensor integration vector for each channel, in parallel,
+  // and distribute it to the rows of the transfer matrix
   //
-  Vector ch_response_f;
-  Vector weights(nin_f);
-  Vector weights_long(nin, 0.0);
+  SparseRows rows(nout);
+  // One message per iteration, the lowest index is reported
+  ArrayOfString fail_msg(nout_f);
   //
+#pragma omp parallel for if (!arts_omp_in_parallel() && nout_f > 1)
   for (Index ifr = 0; ifr < nout_f; ifr++) {
-    const Index irp = ifr * freq_full;
-
-    //The spectrometer response is shifted for each centre frequency step
-    ch_response_f = ch_response[irp].get_numeric_grid(GFIELD1_F_GRID);
-    ch_response_f += ch_f[ifr];
-
-    // Call *integration_func_by_vecmult* and store it in the temp vector
-    integration_func_by_vecmult(
-        weights, ch_response[irp].data, ch_response_f, sensor_f);
-
-    // Normalise if flag is set
-    if (do_norm) weights /= sum(weights);
-
-    // Loop over polarisation and spectra (viewing directions)
-    // Weights change only with frequency
-    for (Index sp = 0; sp < n_sp; sp++) {
-      for (Index pol = 0; pol < n_pol; pol++) {
-        // Distribute the compact weight vector into weight_long
-        weights_long[Range(sp * nin_f * n_pol + pol, nin_f, n_pol)] = weights;
-
-        // Insert temp_long into H at the correct row
-        H.insert_row(sp * nout_f * n_pol + ifr * n_pol + pol, weights_long);
-
-        // Reset weight_long to zero.
-        weights_long = 0.0;
+    try {
+      const Index irp = ifr * freq_full;
+
+      //The spectrometer response is shifted for each centre frequency step
+      Vector ch_response_f{ch_response[irp].get_numeric_grid(GFIELD1_F_GRID)};
+      ch_response_f += ch_f[ifr];
+
+      // Call *integration_func_by_vecmult* and store it in the temp vector
+      Vector weights(nin_f);
+      integration_func_by_vecmult(
+          weights, ch_response[irp].data, ch_response_f, sensor_f);
+
+      // Normalise if flag is set
+      if (do_norm) weights /= sum(weights);
+
+      // Loop over polarisation and spectra (viewing directions)
+      // Weights change only with frequency
+      for (Index sp = 0; sp < n_sp; sp++) {
+        for (Index pol = 0; pol < n_pol; pol++) {
+          rows.set(sp * nout_f * n_pol + ifr * n_pol + pol,
+                   sp * nin_f * n_pol + pol,
+                   n_pol,
+                   weights);
+        }
       }
+    } catch (const std::exception& e) {
+      fail_msg[ifr] = e.what();
     }
   }
+
+  for (const auto& msg : fail_msg) ARTS_USER_ERROR_IF(msg.nelem(), msg);
+
+  rows.insert(H);
 }
 
 
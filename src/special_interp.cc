@@ -106,6 +106,47 @@ void interp_atmfield_by_itw(VectorView x,
   }
 }
 
+void interp_atmfield_by_itw(MatrixView x,
+                            const Index& atmosphere_dim,
+                            const Array<ConstTensor3View>& x_fields,
+                            const ArrayOfGridPos& gp_p,
+                            const ArrayOfGridPos& gp_lat,
+                            const ArrayOfGridPos& gp_lon,
+                            ConstMatrixView itw) {
+  const Index n = gp_p.nelem();
+  const Index nq = x_fields.nelem();
+  ARTS_ASSERT(x.nrows() == nq);
+  ARTS_ASSERT(x.ncols() == n);
+  ARTS_ASSERT(itw.nrows() == n);
+  ARTS_ASSERT(itw.ncols() == (Index(1) << atmosphere_dim));
+
+  const Index nlat = atmosphere_dim > 1 ? 2 : 1;
+  const Index nlon = atmosphere_dim > 2 ? 2 : 1;
+
+  // The corners are summed in the same order as by interp, for each field,
+  // to get results identical to the single field version
+  Vector xq(nq);
+  for (Index i = 0; i < n; ++i) {
+    const Index ip = gp_p[i].idx;
+    const Index ilat = atmosphere_dim > 1 ? gp_lat[i].idx : 0;
+    const Index ilon = atmosphere_dim > 2 ? gp_lon[i].idx : 0;
+
+    xq = 0;
+    Index iti = 0;
+    for (Index p = 0; p < 2; ++p) {
+      for (Index r = 0; r < nlat; ++r) {
+        for (Index c = 0; c < nlon; ++c) {
+          const Numeric w = itw(i, iti++);
+          for (Index q = 0; q < nq; ++q) {
+            xq[q] += x_fields[q](ip + p, ilat + r, ilon + c) * w;
+          }
+        }
+      }
+    }
+    x(joker, i) = xq;
+  }
+}
+
 void interp_atmfield_by_gp(VectorView x,
                            const Index& atmosphere_dim,
                            ConstTensor3View x_field,
@@ -76,6 +76,32 @@ void interp_atmfield_by_itw(VectorView x,
                             const ArrayOfGridPos& gp_lon,
                             ConstMatrixView itw);
 
+/** Interpolates several atmospheric fields with pre-calculated weights.
+
+    As the version for a single field, but all fields are handled in one
+    pass over the positions. The grid cell corners and their weights are
+    then only looked up once per position. The fields must all have the
+    layout of *t_field*.
+
+    @param[out]  x                  Interpolated values, with one row per
+                                    field and one column per position. Must
+                                    have the correct size.
+    @param[in]   atmosphere_dim     As the WSV with the same name.
+    @param[in]   x_fields           The atmospheric fields to be interpolated.
+    @param[in]   gp_p               Pressure grid positions.
+    @param[in]   gp_lat             Latitude grid positions.
+    @param[in]   gp_lon             Longitude grid positions.
+    @param[in]   itw                Interpolation weights from 
+                                    interp_atmfield_gp2itw.
+ */
+void interp_atmfield_by_itw(MatrixView x,
+                            const Index& atmosphere_dim,
+                            const Array<ConstTensor3View>& x_fields,
+                            const ArrayOfGridPos& gp_p,
+                            const ArrayOfGridPos& gp_lat,
+                            const ArrayOfGridPos& gp_lon,
+                            ConstMatrixView itw);
+
 /** Interpolates an atmospheric field given the grid positions.
 
     The function performs the interpolation for a number of positions. The
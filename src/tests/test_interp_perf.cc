@@ -380,8 +380,67 @@ std::vector<Timing> test_tensor5_reinterp(Index n) {
   return out;
 }
 
+std::vector<Timing> test_3d_regrid(Index n) {
+  // A reanalysis-like field: 37 pressure levels, n latitudes and 2n-1
+  // longitudes on a regular global grid, regridded to a finer pressure
+  // grid and a coarser, shifted horizontal grid
+  const Index np = 37, nlat = n, nlon = 2 * n - 1;
+  Vector p(np), lat(nlat), lon(nlon);
+  for (Index i = 0; i < np; i++) p[i] = 1e5 * std::pow(1e-3, Numeric(i) / Numeric(np - 1));
+  for (Index i = 0; i < nlat; i++) lat[i] = -90 + 180 * Numeric(i) / Numeric(nlat - 1);
+  for (Index i = 0; i < nlon; i++) lon[i] = 360 * Numeric(i) / Numeric(nlon - 1);
+
+  Tensor3 field(np, nlat, nlon);
+  for (Index i = 0; i < np; i++)
+    for (Index j = 0; j < nlat; j++)
+      for (Index k = 0; k < nlon; k++)
+        field(i, j, k) = 200 + 50 * std::cos(lat[j] * 0.0174) * std::sin(lon[k] * 0.0174) + std::log(p[i]);
+
+  const Index np2 = 2 * np - 1, nlat2 = 2 * nlat / 3, nlon2 = 2 * nlon / 3;
+  Vector p2(np2), lat2(nlat2), lon2(nlon2);
+  for (Index i = 0; i < np2; i++) p2[i] = p[0] * std::pow(p[np - 1] / p[0], Numeric(i) / Numeric(np2 - 1));
+  for (Index i = 0; i < nlat2; i++) lat2[i] = -89 + 178 * Numeric(i) / Numeric(nlat2 - 1);
+  for (Index i = 0; i < nlon2; i++) lon2[i] = 0.1 + 359.8 * Numeric(i) / Numeric(nlon2 - 1);
+
+  std::vector<Timing> out;
+  Numeric X;
+
+  for (Index order : {1, 3}) {
+    const auto lag_p = my_interp::lagrange_interpolation_list<LagrangeLogInterpolation>(p2, p, order, 0.5);
+    const auto lag_lat = my_interp::lagrange_interpolation_list<LagrangeInterpolation>(lat2, lat, order);
+    const auto lag_lon = my_interp::lagrange_interpolation_list<LagrangeCyclic0to360Interpolation>(lon2, lon, order, 0.5);
+    const auto itw_p = interpweights(lag_p);
+    const auto itw_latlon = interpweights(lag_lat, lag_lon);
+
+    Tensor3 latlon(np, nlat2, nlon2);
+    out.emplace_back(order == 1 ? "order-1-latlon-per-level" : "order-3-latlon-per-level")([&](){
+      for (Index i = 0; i < np; i++)
+        reinterp(latlon(i, joker, joker), field(i, joker, joker), itw_latlon, lag_lat, lag_lon);
+      X = latlon(np / 2, nlat2 / 2, nlon2 / 2);
+    });
+
+    Tensor3 regrid(np2, nlat2, nlon2);
+    out.emplace_back(order == 1 ? "order-1-p-per-column" : "order-3-p-per-column")([&](){
+      for (Index j = 0; j < nlat2; j++)
+        for (Index k = 0; k < nlon2; k++)
+          reinterp(regrid(joker, j, k), latlon(joker, j, k), itw_p, lag_p);
+      X = regrid(np2 / 2, nlat2 / 2, nlon2 / 2);
+    });
+
+    Tensor3 regrid_batch(np2, nlat2, nlon2);
+    out.emplace_back(order == 1 ? "order-1-p-leading-dim" : "order-3-p-leading-dim")([&](){
+      reinterp_leading_dim(regrid_batch, latlon, itw_p, lag_p);
+      X = regrid_batch(np2 / 2, nlat2 / 2, nlon2 / 2);
+    });
+
+    if (regrid_batch != regrid) throw std::runtime_error("Batched p regridding differs");
+  }
+
+  return out;
+}
+
 int main(int argc, char** c) {
-    std::array <Index, 4> N;
+    std::array <Index, 5> N;
   if (static_cast<std::size_t>(argc) < 1 + 1 + N.size()) {
     std::cerr << "Expects PROGNAME NREPEAT NSIZE..., wehere NSIZE is " << N.size() << " indices\n";
     return EXIT_FAILURE;
@@ -395,5 +454,6 @@ int main(int argc, char** c) {
     std::cout << N[1] << " input test_linear_startup_cost\n" << test_linear_startup_cost(N[1]) << '\n';
     std::cout << N[2] << " input test_linear_interpweights_cost\n" << test_linear_interpweights_cost(N[2]) << '\n';
     std::cout << N[3] << " input test_tensor5_reinterp\n" << test_tensor5_reinterp(N[3]) << '\n';
+    std::cout << N[4] << " input test_3d_regrid\n" << test_3d_regrid(N[4]) << '\n';
   }
 }
@@ -480,6 +480,77 @@ Numeric test_insert_row(Index ntests, bool verbose) {
   return err_max;
 }
 
+//! Test row iteration and row_argmax.
+/*!
+
+  Fills random rows of a sparse matrix with values in [-4, 2], leaving
+  gaps of zeros that are not stored, and compares Sparse::row_argmax(...)
+  with a scan of the dense matrix. Also checks that for_each_in_row(...)
+  visits exactly the non-zero elements. Rows of only negative values with a
+  gap make the max an implicit zero, this case is also tested explicitly.
+
+  \param ntest The number of tests to perform.
+  \param verbose If true, test results for each test are printed to stdout.
+
+  \return 0.0 if all tests pass, otherwise 1.0.
+*/
+Numeric test_row_argmax(Index ntests, bool verbose) {
+  if (verbose) cout << endl << "Testing row_argmax:" << endl << endl;
+
+  // A fixed case: the max of the row is the zero at column 1
+  {
+    Sparse A(1, 4);
+    A.rw(0, 0) = -2;
+    A.rw(0, 2) = -1;
+    A.rw(0, 3) = -3;
+    if (A.row_argmax(0) != 1) {
+      if (verbose) cout << "FAILED: Implicit zero not found." << endl;
+      return 1.0;
+    }
+  }
+
+  for (Index i = 0; i < ntests; i++) {
+    Index m = (std::rand() % 10) + 1;
+    Index n = (std::rand() % 10) + 1;
+
+    Sparse A_sparse(m, n);
+    for (Index r = 0; r < m; r++) {
+      for (Index c = 0; c < n; c++) {
+        if (std::rand() % 3) A_sparse.rw(r, c) = (std::rand() % 7) - 4;
+      }
+    }
+    A_sparse.matrix.prune(0.0);
+    const Matrix A = static_cast<Matrix>(A_sparse);
+
+    for (Index r = 0; r < m; r++) {
+      Index jmax = 0;
+      for (Index c = 1; c < n; c++) {
+        if (A(r, c) > A(r, jmax)) jmax = c;
+      }
+
+      Numeric sum = 0;
+      Index count = 0;
+      A_sparse.for_each_in_row(r, [&](Index c, Numeric v) {
+        sum += std::abs(v - A(r, c));
+        count++;
+      });
+      Index nonzero = 0;
+      for (Index c = 0; c < n; c++) {
+        if (A(r, c) != 0) nonzero++;
+      }
+
+      if (A_sparse.row_argmax(r) != jmax || sum != 0 || count != nonzero) {
+        if (verbose) {
+          cout << "FAILED: Row " << r << " of" << endl << A << endl;
+        }
+        return 1.0;
+      }
+    }
+  }
+
+  return 0.0;
+}
+
 //! Test sparse identity matrix.
 /*!
 
@@ -1161,5 +1232,12 @@ int main() {
   else
     cout << "FAILED (Error: " << err << ")" << endl;
 
+  cout << "Testing row_argmax: ";
+  err = test_row_argmax(1000, false);
+  if (err < 1e-11)
+    cout << "PASSED" << endl;
+  else
+    cout << "FAILED (Error: " << err << ")" << endl;
+
   return 0;
 }
@@ -11,6 +11,7 @@
 #include "transmissionmatrix.h"
 
 #include "arts_conversions.h"
+#include "arts_omp.h"
 #include "double_imanip.h"
 
 TransmissionMatrix::TransmissionMatrix(Index nf, Index stokes)
@@ -2019,9 +2020,12 @@ void set_backscatter_radiation_vector(
   const Index nq = np ? dI[0][0].nelem() : 0;
 
   // For all transmission, the I-vector is the same
+#pragma omp parallel for if (!arts_omp_in_parallel())
   for (Index ip = 0; ip < np; ip++)
     I[ip].setBackscatterTransmission(I_incoming, PiTr[ip], PiTf[ip], Z[ip]);
 
+  // The derivatives of each point are independent of each other
+#pragma omp parallel for if (!arts_omp_in_parallel())
   for (Index ip = 0; ip < np; ip++) {
     for (Index iq = 0; iq < nq; iq++) {
       dI[ip][ip][iq].setBackscatterTransmissionDerivative(
@@ -2035,6 +2039,7 @@ void set_backscatter_radiation_vector(
       switch (ns) {
         case 1: {
         BackscatterSolverCommutativeTransmissionStokesDimOne:
+#pragma omp parallel for if (!arts_omp_in_parallel()) schedule(dynamic)
           for (Index ip = 0; ip < np; ip++) {
             for (Index j = ip; j < np; j++) {
               for (Index iq = 0; iq < nq; iq++) {
@@ -2055,6 +2060,7 @@ void set_backscatter_radiation_vector(
           }
         } break;
         case 2: {
+#pragma omp parallel for if (!arts_omp_in_parallel()) schedule(dynamic)
           for (Index ip = 0; ip < np; ip++) {
             for (Index j = ip; j < np; j++) {
               for (Index iq = 0; iq < nq; iq++) {
@@ -2075,6 +2081,7 @@ void set_backscatter_radiation_vector(
           }
         } break;
         case 3: {
+#pragma omp parallel for if (!arts_omp_in_parallel()) schedule(dynamic)
           for (Index ip = 0; ip < np; ip++) {
             for (Index j = ip; j < np; j++) {
               for (Index iq = 0; iq < nq; iq++) {
@@ -2095,6 +2102,7 @@ void set_backscatter_radiation_vector(
           }
         } break;
         case 4: {
+#pragma omp parallel for if (!arts_omp_in_parallel()) schedule(dynamic)
           for (Index ip = 0; ip < np; ip++) {
             for (Index j = ip; j < np; j++) {
               for (Index iq = 0; iq < nq; iq++) {
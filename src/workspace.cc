@@ -3101,6 +3101,20 @@ This variable is set to the default provided by *isotopologue_ratiosInitFromBuil
           "Size: user-defined\n"),
       GROUP("ArrayOfPpath")));
 
+  wsv_data.push_back(WsvRecord(
+      NAME("ppath_field_settings"),
+      DESCRIPTION(
+          "The settings used to calculate *ppath_field*.\n"
+          "\n"
+          "Set by *ppath_fieldStepByStep* and checked by *ppathFromPpathField*.\n"
+          "The first element identifies the calculation of the field, the\n"
+          "other elements describe settings affecting the paths, such as\n"
+          "*ppath_step_agenda*, *f_grid* and *ppath_lmax*. Other methods\n"
+          "setting *ppath_field* leave this variable empty.\n"
+          "\n"
+          "Usage:      Output of *ppath_fieldStepByStep*.\n"),
+      GROUP("ArrayOfString"), ArrayOfString{}));
+
   wsv_data.push_back(WsvRecord(
       NAME("ppath_inside_cloudbox_do"),
       DESCRIPTION(
@@ -3498,6 +3512,22 @@ This is an experimental solution.
       DESCRIPTION("Agenda calculating the refractive index of air.\n"),
       GROUP("Agenda")));
 
+  wsv_data.push_back(WsvRecord(
+      NAME("refr_index_air_field"),
+      DESCRIPTION(
+          "Refractive index of air at the atmospheric grid points.\n"
+          "\n"
+          "The first book holds the refractive index (*refr_index_air*) and\n"
+          "the second one the group index (*refr_index_air_group*). Remaining\n"
+          "dimensions match *t_field*.\n"
+          "\n"
+          "Usage: Set by *refr_index_air_fieldCalc*.\n"
+          "\n"
+          "Unit: 1\n"
+          "\n"
+          "Dimensions: [ 2, p_grid, lat_grid, lon_grid ]\n"),
+      GROUP("Tensor4")));
+
   wsv_data.push_back(WsvRecord(
       NAME("refr_index_air_group"),
       DESCRIPTION(